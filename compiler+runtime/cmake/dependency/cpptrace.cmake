@@ -6,10 +6,14 @@ set(CMAKE_CXX_CLANG_TIDY_OLD ${CMAKE_CXX_CLANG_TIDY})
   set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -w")
   set(CMAKE_CXX_CLANG_TIDY "")
   set(CPPTRACE_STD_FORMAT OFF CACHE BOOL "Disable std::format usage, to speed up compilation")
+  # The sampling profiler unwinds from within a signal handler, which cpptrace can only do
+  # with libunwind.
+  set(CPPTRACE_UNWIND_WITH_LIBUNWIND ON CACHE BOOL "Unwind with libunwind, which is signal safe")
 
   add_subdirectory(third-party/cpptrace)
 
   unset(CPPTRACE_STD_FORMAT)
+  unset(CPPTRACE_UNWIND_WITH_LIBUNWIND)
 set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS_OLD}")
 set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS_OLD}")
 set(BUILD_SHARED_LIBS ${BUILD_SHARED_LIBS_OLD})
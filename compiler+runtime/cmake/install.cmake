@@ -72,6 +72,7 @@ jank_glob_install_without_prefix(
 )
 
 install(FILES ${CMAKE_SOURCE_DIR}/../.clang-format DESTINATION share)
+install(FILES ${CMAKE_BINARY_DIR}/jank-inline.bc DESTINATION share)
 
 if(PROJECT_IS_TOP_LEVEL)
   include(CPack)
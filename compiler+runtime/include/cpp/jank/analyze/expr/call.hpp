@@ -30,5 +30,9 @@ namespace jank::analyze::expr
      * back to it if an exception is thrown during eval. */
     runtime::obj::persistent_list_ref form{};
     native_vector<expression_ref> arg_exprs;
+    /* When the source is a var which was last def'd to a fn with a fixed arity matching
+     * this call, this points to that fn. Codegen uses it to call the arity directly,
+     * guarded by a check that the var's root is still that fn. */
+    jtl::ptr<struct function> direct_fn{};
   };
 }
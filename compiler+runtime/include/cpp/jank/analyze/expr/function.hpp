@@ -75,6 +75,9 @@ namespace jank::analyze::expr
     jtl::immutable_string unique_name;
     native_vector<function_arity> arities;
     runtime::obj::persistent_hash_map_ref meta{};
+    /* Set by the escape analysis step. A fn which doesn't escape can have its closure
+     * context allocated on the stack. */
+    bool escapes{ true };
   };
 }
 
@@ -48,6 +48,9 @@ namespace jank::analyze
     bool needs_box{ true };
     bool has_boxed_usage{};
     bool has_unboxed_usage{};
+    /* Set when a later binding in the same frame reuses this name. Lookups still land on
+     * this binding, so its value expression isn't necessarily the live one. */
+    bool rebound{};
 
     runtime::object_ref to_runtime_data() const;
   };
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <jank/analyze/expr/let.hpp>
+
+namespace jank::analyze::step
+{
+  /* Marks fns bound in this let which never escape it. A fn doesn't escape if every
+   * reference to its local is as the callee of a call within the same arity. Codegen
+   * can then put the closure context on the stack, rather than the GC heap. */
+  void mark_non_escaping(expr::let_ref let);
+}
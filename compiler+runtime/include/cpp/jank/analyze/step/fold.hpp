@@ -0,0 +1,12 @@
+#pragma once
+
+#include <jank/analyze/expr/call.hpp>
+#include <jank/analyze/expr/primitive_literal.hpp>
+
+namespace jank::analyze::step
+{
+  /* Evaluates calls to a known set of pure core fns at analysis time, when every arg is a
+   * constant. Let bindings to constants are seen through, so these fold transitively. If
+   * the call can't be folded, for whatever reason, none is returned and it's left as is. */
+  jtl::option<expr::primitive_literal_ref> fold_call(expr::call_ref call);
+}
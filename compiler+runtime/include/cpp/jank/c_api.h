@@ -59,6 +59,7 @@ extern "C"
   jank_object_ref jank_keyword_intern(jank_object_ref ns, jank_object_ref name);
 
   jank_object_ref jank_deref(jank_object_ref o);
+  jank_object_ref jank_var_deref_root(jank_object_ref var);
 
   jank_object_ref jank_call0(jank_object_ref f);
   jank_object_ref jank_call1(jank_object_ref f, jank_object_ref a1);
@@ -215,6 +216,9 @@ extern "C"
                                                       jank_object_ref,
                                                       jank_object_ref));
 
+  jank_bool jank_function_has_arity(jank_object_ref fn, jank_u8 arity, void *f);
+  jank_object_ref *jank_direct_call_cache_create();
+
   jank_object_ref jank_closure_create(jank_arity_flags arity_flags, void *context);
   void jank_closure_set_arity0(jank_object_ref fn, jank_object_ref (*f)());
   void jank_closure_set_arity1(jank_object_ref fn, jank_object_ref (*f)(jank_object_ref));
@@ -290,10 +294,13 @@ extern "C"
   jank_object_ref
   jank_try(jank_object_ref try_fn, jank_object_ref catch_fn, jank_object_ref finally_fn);
 
-  void jank_profile_enter(char const *label);
-  void jank_profile_exit(char const *label);
+  jank_u32 jank_profile_region(char const *label);
+  void jank_profile_enter(jank_u32 region);
+  void jank_profile_exit(jank_u32 region);
   void jank_profile_report(char const *label);
 
+  void jank_tier_up(char const *body_name, void **tier);
+
 #ifdef __cplusplus
 }
 #endif
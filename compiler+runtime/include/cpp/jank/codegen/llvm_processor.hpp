@@ -55,10 +55,19 @@ namespace jank::analyze
   }
 }
 
+namespace llvm
+{
+  class MemoryBuffer;
+}
+
 namespace jank::codegen
 {
   using namespace jank::runtime;
 
+  /* The bitcode for the C API fns which we inline into generated code. It's built alongside
+   * jank and read the first time it's needed. This is null if it can't be found. */
+  llvm::MemoryBuffer const *inline_bitcode();
+
   enum class compilation_target : u8
   {
     module,
@@ -66,9 +75,11 @@ namespace jank::codegen
     eval
   };
 
+  enum class native_math_op : u8;
+
   struct reusable_context
   {
-    reusable_context(jtl::immutable_string const &module_name);
+    reusable_context(jtl::immutable_string const &module_name, bool tiered);
 
     jtl::immutable_string module_name;
     jtl::immutable_string ctor_name;
@@ -78,6 +89,8 @@ namespace jank::codegen
     std::unique_ptr<llvm::IRBuilder<>> builder;
     llvm::Value *nil{};
     llvm::BasicBlock *global_ctor_block{};
+    /* The profile region for the global ctor, if profiling is enabled. */
+    llvm::Value *profile_region{};
 
     /* TODO: Is this needed, given lifted constants? */
     native_unordered_map<runtime::object_ref,
@@ -88,6 +101,16 @@ namespace jank::codegen
     native_unordered_map<obj::symbol_ref, llvm::Value *> var_globals;
     native_unordered_map<jtl::immutable_string, llvm::Value *> c_string_globals;
 
+    /* When tiered, each fn arity is split into a small entry fn, which counts calls and
+     * dispatches to an optimized version once one exists, and the body, which we can
+     * recompile with more optimizations once it's hot. These are the body names. */
+    bool tiered{};
+    native_vector<jtl::immutable_string> tiered_fns;
+
+    /* Every fn arity generated into this module, including nested fns. These are optimized
+     * together once the root fn is done. */
+    native_vector<llvm::Function *> generated_fns;
+
     /* Optimization details. */
     std::unique_ptr<llvm::FunctionPassManager> fpm;
     std::unique_ptr<llvm::LoopAnalysisManager> lam;
@@ -119,6 +142,9 @@ namespace jank::codegen
     llvm_processor(llvm_processor &&) noexcept = default;
 
     jtl::string_result<void> gen();
+    /* Runs our optimization passes over the generated module. This is separate from gen,
+     * so that we can skip it when the compiled module is already cached. */
+    void optimize();
     llvm::Value *gen(analyze::expression_ref, analyze::expr::function_arity const &);
     llvm::Value *gen(analyze::expr::def_ref, analyze::expr::function_arity const &);
     llvm::Value *gen(analyze::expr::var_deref_ref, analyze::expr::function_arity const &);
@@ -142,6 +168,11 @@ namespace jank::codegen
     llvm::Value *gen(analyze::expr::try_ref, analyze::expr::function_arity const &);
     llvm::Value *gen(analyze::expr::case_ref, analyze::expr::function_arity const &);
 
+    llvm::Value *gen_direct_call(analyze::expr::function_ref direct_fn,
+                                 llvm::FunctionCallee dynamic_fn,
+                                 llvm::ArrayRef<llvm::Value *> arg_handles);
+    llvm::Value *gen_native_math(native_math_op op, llvm::ArrayRef<llvm::Value *> args) const;
+    llvm::Value *gen_box(llvm::Value *v) const;
     llvm::Value *gen_var(obj::symbol_ref qualified_name) const;
     llvm::Value *gen_c_string(jtl::immutable_string const &s) const;
 
@@ -150,6 +181,7 @@ namespace jank::codegen
     void create_function();
     void create_function(analyze::expr::function_arity const &arity);
     void create_global_ctor() const;
+    void create_tier_entry(llvm::Function *body, jtl::immutable_string const &name) const;
     llvm::GlobalVariable *create_global_var(jtl::immutable_string const &name) const;
 
     llvm::Value *gen_global(runtime::obj::nil_ref) const;
@@ -163,7 +195,9 @@ namespace jank::codegen
     llvm::Value *gen_global(runtime::obj::character_ref c) const;
     llvm::Value *gen_global_from_read_string(runtime::object_ref o) const;
     llvm::Value *gen_function_instance(analyze::expr::function_ref expr,
-                                       analyze::expr::function_arity const &fn_arity);
+                                       analyze::expr::function_arity const &fn_arity,
+                                       bool escapes);
+    llvm::Value *gen_closure_context(llvm::StructType *type, bool escapes) const;
 
     llvm::StructType *get_or_insert_struct_type(std::string const &name,
                                                 std::vector<llvm::Type *> const &fields) const;
@@ -173,6 +207,9 @@ namespace jank::codegen
     jtl::ptr<llvm::Function> fn{};
     std::unique_ptr<reusable_context> ctx;
     native_unordered_map<obj::symbol_ref, llvm::Value *> locals;
+    /* Unboxed locals which also have boxed usages are boxed once, when bound, and
+     * the boxed value lives here. */
+    native_unordered_map<obj::symbol_ref, llvm::Value *> boxed_locals;
     /* TODO: Use gc allocator to avoid leaks. */
     std::list<deferred_init> deferred_inits{};
   };
@@ -2,9 +2,14 @@
 
 #include <jank/runtime/object.hpp>
 
-namespace jank::runtime::obj
+namespace jank::runtime
 {
-  using symbol_ref = oref<struct symbol>;
+  using var_ref = oref<struct var>;
+
+  namespace obj
+  {
+    using symbol_ref = oref<struct symbol>;
+  }
 }
 
 namespace jank::analyze
@@ -48,6 +53,18 @@ namespace jank::evaluate
                                                analyze::processor const &an_prc,
                                                jtl::immutable_string const &name);
 
+  /* Interns the var for a def and applies its meta, without evaluating its value. This
+   * is everything later analysis needs to know about the def. */
+  runtime::var_ref intern_def(analyze::expr::def_ref);
+
+  /* Evaluates all of the exprs together, as a single JIT compiled module, and returns
+   * the value of the last one. */
+  runtime::object_ref eval_batch(native_vector<analyze::expression_ref> const &exprs,
+                                 analyze::processor const &an_prc);
+
+  /* How many interpreted fns have been JIT compiled so far. */
+  usize promoted_fn_count();
+
   runtime::object_ref eval(analyze::expression_ref);
   runtime::object_ref eval(analyze::expr::def_ref);
   runtime::object_ref eval(analyze::expr::var_deref_ref);
@@ -41,43 +41,88 @@ namespace jank::hash
   u32 ordered(runtime::object const * const sequence);
   u32 unordered(runtime::object const * const sequence);
 
+  /* Ordered collections hash as 31^n + h(0) * 31^(n - 1) + ... + h(n - 1), which is then
+   * mixed with n. Keeping that sum around allows for items to be added to or removed from the
+   * end without hashing the rest again. */
+  u32 ordered_push(u32 const sum, u32 const item_hash);
+  u32 ordered_pop(u32 const sum, u32 const item_hash);
+
+  /* Unordered collections hash as the sum of their entries' hashes, which is then mixed with
+   * the count. Keeping that sum around allows for entries to come and go without hashing the
+   * rest again. */
+  u32 unordered_entry(runtime::oref<runtime::object> const o);
+  u32 unordered_entry(runtime::oref<runtime::object> const key,
+                      runtime::oref<runtime::object> const val);
+
+  /* Whether the object's hash can be had without walking anything, either because it's a
+   * scalar or because it's a collection which has already been hashed. Collections only keep
+   * their sums up to date for items like this, since hashing anything else could walk a large
+   * or even infinite lazy sequence. */
+  bool is_cached(runtime::oref<runtime::object> const o);
+
+  template <typename E>
+  u32 unordered_item(E const &e)
+  {
+    /* It's common that we have pairs of data, like with maps. */
+    if constexpr(requires(E t) { t.first, t.second; })
+    {
+      return unordered_entry(e.first, e.second);
+    }
+    else
+    {
+      return unordered_entry(e.get());
+    }
+  }
+
+  template <typename It>
+  u32 ordered_sum(It const &begin, It const &end)
+  {
+    u32 sum{ 1 };
+    for(auto it(begin); it != end; ++it)
+    {
+      sum = ordered_push(sum, visit((*it)));
+    }
+    return sum;
+  }
+
+  template <typename It>
+  u32 unordered_sum(It const &begin, It const &end)
+  {
+    u32 sum{};
+    for(auto it(begin); it != end; ++it)
+    {
+      sum += unordered_item(*it);
+    }
+    return sum;
+  }
+
   template <typename It>
   u32 ordered(It const &begin, It const &end)
   {
     u32 n{};
-    u32 hash{ 1 };
+    u32 sum{ 1 };
 
     for(auto it(begin); it != end; ++it)
     {
-      hash = 31 * hash + visit((*it));
+      sum = ordered_push(sum, visit((*it)));
       ++n;
     }
 
-    return mix_collection_hash(hash, n);
+    return mix_collection_hash(sum, n);
   }
 
   template <typename It>
   u32 unordered(It const &begin, It const &end)
   {
-    using T = typename std::iterator_traits<It>::value_type;
-
-    u32 hash{};
     u32 n{};
+    u32 sum{};
 
     for(auto it(begin); it != end; ++it)
     {
-      /* It's common that we have pairs of data, like with maps. */
-      if constexpr(requires(T t) { t.first, t.second; })
-      {
-        hash += 31 * visit((*it).first) + visit((*it).second);
-      }
-      else
-      {
-        hash += visit((*it).get());
-      }
+      sum += unordered_item(*it);
       ++n;
     }
 
-    return mix_collection_hash(hash, n);
+    return mix_collection_hash(sum, n);
   }
 }
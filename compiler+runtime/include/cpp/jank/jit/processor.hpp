@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 
 #include <clang/Interpreter/Interpreter.h>
 
@@ -13,6 +15,13 @@ namespace llvm
 {
   class Module;
   class LLVMContext;
+  class MemoryBuffer;
+
+  namespace orc
+  {
+    class LazyCallThroughManager;
+    class CompileOnDemandLayer;
+  }
 }
 
 namespace clang
@@ -22,6 +31,8 @@ namespace clang
 
 namespace jank::jit
 {
+  struct serialized_ir_layer;
+  struct tier_compiler;
 
   struct processor
   {
@@ -31,16 +42,45 @@ namespace jank::jit
     void eval_string(jtl::immutable_string const &s) const;
     void load_object(native_persistent_string_view const &path) const;
     void load_dynamic_library(jtl::immutable_string const &path) const;
+    /* When given a cache path, and the module is being compiled up front, the compiled
+     * module is also written to the object cache. With lazy compilation, it isn't, since
+     * we'd need to compile all of it. Modules with tiered fns need to list their bodies
+     * here, so we can recompile them later. */
     void load_ir_module(std::unique_ptr<llvm::Module> m,
-                        std::unique_ptr<llvm::LLVMContext> llvm_ctx) const;
+                        std::unique_ptr<llvm::LLVMContext> llvm_ctx,
+                        jtl::immutable_string const &cache_path = {},
+                        native_vector<jtl::immutable_string> const &tiered_fns = {}) const;
+
+    /* Compiled objects are cached on disk, keyed by the IR as it was generated, so an
+     * identical module in a later process can skip optimization and compilation entirely.
+     * The cache path is empty when the cache is disabled and the cached object is null
+     * when there isn't one. Once the cache is too big, the least recently used objects are
+     * evicted. That's checked at startup and after every so many bytes we write. */
+    jtl::immutable_string object_cache_path(llvm::Module const &m) const;
+    std::unique_ptr<llvm::MemoryBuffer>
+    find_cached_object(jtl::immutable_string const &cache_path) const;
+    void load_cached_object(std::unique_ptr<llvm::MemoryBuffer> object,
+                            std::unique_ptr<llvm::Module> m,
+                            std::unique_ptr<llvm::LLVMContext> llvm_ctx,
+                            native_vector<jtl::immutable_string> const &tiered_fns) const;
     void load_bitcode(jtl::immutable_string const &module,
                       native_persistent_string_view const &bitcode) const;
 
+    /* Tiered compilation. Once a tiered fn is hot, tier_up will recompile its body with
+     * full optimizations, in the background, and then store the new body in the tier slot.
+     * Only the tiered bodies of each module are kept for that, as bitcode, and only up to
+     * a fixed total size. See llvm_processor::create_tier_entry. */
+    void tier_up(jtl::immutable_string const &body_name, void **tier) const;
+    /* How many fns have been recompiled so far. */
+    usize tiered_up_count() const;
+
     jtl::string_result<void> remove_symbol(jtl::immutable_string const &name) const;
 
     template <typename T>
     jtl::string_result<T> find_symbol(jtl::immutable_string const &name) const
     {
+      /* Looking up a symbol may compile the module which defines it. */
+      std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
       if(auto symbol{ interpreter->getSymbolAddress(name.c_str()) })
       {
         return symbol.get().toPtr<T>();
@@ -56,7 +96,27 @@ namespace jank::jit
     jtl::option<jtl::immutable_string> find_dynamic_lib(jtl::immutable_string const &lib) const;
 
     std::unique_ptr<clang::Interpreter> interpreter;
+    /* The interpreter's JIT compiles with a compiler which isn't thread-safe, so anything
+     * which may compile through it, from any thread, needs to hold this. It's recursive,
+     * since compiling one fn may need to materialize another. clang::Interpreter builds
+     * that JIT itself, so we can't give it a concurrent compiler, which is why compiles
+     * aren't spread across a pool of threads. */
+    mutable std::recursive_mutex compile_mutex;
     i64 optimization_level{};
+
+    /* When lazy JIT compilation is enabled, IR modules go through these layers, so each fn
+     * is only compiled the first time it's called. */
+    std::unique_ptr<llvm::orc::LazyCallThroughManager> lazy_call_through;
+    std::unique_ptr<serialized_ir_layer> serialized_layer;
+    std::unique_ptr<llvm::orc::CompileOnDemandLayer> lazy_layer;
+    /* Empty when the object cache is disabled. */
+    jtl::immutable_string object_cache_dir;
+    /* Everything other than the IR which goes into a cache key. */
+    jtl::immutable_string object_cache_build;
+    mutable std::atomic<usize> object_cache_bytes_written{};
+    /* Zero when tiered compilation is disabled. */
+    u32 tier_up_threshold{};
+    std::unique_ptr<tier_compiler> tiers;
     native_vector<std::filesystem::path> library_dirs;
   };
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <jtl/result.hpp>
+
+namespace jank::profile::sample
+{
+  /* A statistical profiler, as opposed to the instrumented timers. While running, SIGPROF
+   * is delivered at roughly the given frequency, in CPU time, to whichever thread is running.
+   * The handler only records raw return addresses. Everything is symbolized once sampling
+   * stops, including JIT compiled fns, which are named by their demunged jank names.
+   *
+   * This fails if cpptrace can't unwind from within a signal handler. */
+  jtl::string_result<void> start(u32 frequency);
+
+  /* Stops sampling and returns the collected stacks in the folded format used by
+   * flamegraph.pl and friends: one line per unique stack, root first, with its count. */
+  jtl::string_result<jtl::immutable_string> stop();
+
+  bool is_running();
+}
@@ -1,23 +1,82 @@
 #pragma once
 
+#include <algorithm>
+#include <concepts>
+
 #include <jank/util/cli.hpp>
 
 namespace jank::profile
 {
+  /* Profile regions are identified by small integers, rather than by their labels. Static
+   * labels are interned once, at start up, via `region<"label">`. Dynamic labels are only
+   * built and interned when profiling is enabled. Zero is never a valid region. */
+  using region_id = u32;
+
+  namespace detail
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    extern bool enabled;
+
+    template <usize N>
+    struct region_label
+    {
+      /* NOLINTNEXTLINE(hicpp-explicit-conversions): Needs to be implicit for NTTP use. */
+      constexpr region_label(char const (&s)[N])
+      {
+        std::copy_n(s, N, data);
+      }
+
+      char data[N]{};
+    };
+  }
+
   void configure(util::cli::options const &opts);
-  bool is_enabled();
-  void enter(native_persistent_string_view const &region);
-  void exit(native_persistent_string_view const &region);
+
+  inline bool is_enabled()
+  {
+    return detail::enabled;
+  }
+
+  region_id intern_region(native_persistent_string_view const &label);
+
+  template <detail::region_label Label>
+  inline region_id const region{ intern_region({ Label.data, sizeof(Label.data) - 1 }) };
+
+  void enter(region_id id);
+  void exit(region_id id);
   void report(native_persistent_string_view const &boundary);
 
+  /* Flushes this thread's records, stops profiling, and closes the output. Records which
+   * other threads haven't flushed yet are dropped. */
+  void finish();
+
+  /* Reads the binary output of `--profile` and returns it as text, with one record per
+   * line, in time order: `jank::profile <ns> <thread> <enter|exit|report> <label>` */
+  jtl::string_result<jtl::immutable_string> decode(jtl::immutable_string const &path);
+
+  /* When profiling is disabled, a timer is just a flag check. */
   struct timer
   {
     timer() = delete;
-    timer(native_persistent_string_view const &region);
+    timer(region_id id);
+
+    /* The label is only built if profiling is enabled. */
+    template <typename F>
+    requires std::invocable<F const &>
+    timer(F const &label)
+    {
+      if(is_enabled())
+      {
+        auto const s(label());
+        id = intern_region({ s.data(), s.size() });
+        enter(id);
+      }
+    }
+
     ~timer();
 
     void report(native_persistent_string_view const &boundary) const;
 
-    jtl::immutable_string region;
+    region_id id{};
   };
 }
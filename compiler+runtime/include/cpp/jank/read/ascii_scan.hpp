@@ -0,0 +1,239 @@
+#pragma once
+
+#include <bit>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  #include <immintrin.h>
+#endif
+
+#include <jank/type.hpp>
+
+/* Most source is ASCII, so the lexer skips over runs of ASCII bytes which can't end the
+ * current token in bulk, 16 or 32 bytes at a time, rather than decoding each one as a
+ * codepoint. Every scan is conservative: it stops at any non-ASCII byte and at any byte which
+ * might end the run, leaving the lexer to decide what to do with it. */
+namespace jank::read::ascii_scan
+{
+  /* Characters which end a symbol or keyword, since the reader gives them a meaning of their
+   * own. The lexer and the block scans both use this list, so they can't disagree. */
+  inline constexpr char specials[]{ '(', ')', '{', '}', '[', ']', '"',
+                                    '^', '\\', '`', '~', ',', ';' };
+
+  constexpr bool is_special(char32_t const c)
+  {
+    for(auto const s : specials)
+    {
+      if(c == static_cast<char32_t>(s))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  namespace detail
+  {
+#if defined(__AVX2__)
+    struct avx2
+    {
+      using block = __m256i;
+      static constexpr usize width{ 32 };
+
+      static block load(char const * const p)
+      {
+        return _mm256_loadu_si256(reinterpret_cast<block const *>(p));
+      }
+
+      static block eq(block const b, char const c)
+      {
+        return _mm256_cmpeq_epi8(b, _mm256_set1_epi8(c));
+      }
+
+      /* Signed, so non-ASCII bytes are less than any ASCII byte. */
+      static block lt(block const b, char const c)
+      {
+        return _mm256_cmpgt_epi8(_mm256_set1_epi8(c), b);
+      }
+
+      static block either(block const l, block const r)
+      {
+        return _mm256_or_si256(l, r);
+      }
+
+      static u32 mask(block const b)
+      {
+        return static_cast<u32>(_mm256_movemask_epi8(b));
+      }
+    };
+#endif
+
+#if defined(__SSE2__)
+    struct sse2
+    {
+      using block = __m128i;
+      static constexpr usize width{ 16 };
+
+      static block load(char const * const p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<block const *>(p));
+      }
+
+      static block eq(block const b, char const c)
+      {
+        return _mm_cmpeq_epi8(b, _mm_set1_epi8(c));
+      }
+
+      static block lt(block const b, char const c)
+      {
+        return _mm_cmplt_epi8(b, _mm_set1_epi8(c));
+      }
+
+      static block either(block const l, block const r)
+      {
+        return _mm_or_si128(l, r);
+      }
+
+      static u32 mask(block const b)
+      {
+        return static_cast<u32>(_mm_movemask_epi8(b));
+      }
+    };
+#endif
+
+    template <typename V, typename Run>
+    [[gnu::always_inline]]
+    inline char const *scan_blocks(char const *it, char const * const end)
+    {
+      while(static_cast<usize>(end - it) >= V::width)
+      {
+        auto const stops(V::mask(Run::template stops<V>(V::load(it))));
+        if(stops != 0)
+        {
+          return it + std::countr_zero(stops);
+        }
+        it += V::width;
+      }
+      return it;
+    }
+
+    /* Returns how many bytes from the start of [begin, end) belong to the run. */
+    template <typename Run>
+    [[gnu::hot]]
+    inline usize scan(char const * const begin, char const * const end)
+    {
+      auto it(begin);
+#if defined(__AVX2__)
+      it = scan_blocks<avx2, Run>(it, end);
+      if(static_cast<usize>(end - it) >= avx2::width)
+      {
+        return static_cast<usize>(it - begin);
+      }
+#endif
+#if defined(__SSE2__)
+      it = scan_blocks<sse2, Run>(it, end);
+      if(static_cast<usize>(end - it) >= sse2::width)
+      {
+        return static_cast<usize>(it - begin);
+      }
+#endif
+      while(it != end && !Run::stops(static_cast<u8>(*it)))
+      {
+        ++it;
+      }
+      return static_cast<usize>(it - begin);
+    }
+
+    /* Bytes between '!' and DEL, other than those which the reader treats specially. The
+     * lexer's is_symbol_char accepts every one of these, including ', @, :, $, and |, so a
+     * run never takes a byte which the per-codepoint loop would have stopped on. Control
+     * bytes stop the run, to be handled by that loop. */
+    struct symbol_run
+    {
+      static constexpr bool stops(u8 const c)
+      {
+        return c <= ' ' || c >= 0x7F || is_special(c);
+      }
+
+      template <typename V>
+      static typename V::block stops(typename V::block const b)
+      {
+        auto ret(V::either(V::lt(b, '!'), V::eq(b, 0x7F)));
+        for(auto const c : specials)
+        {
+          ret = V::either(ret, V::eq(b, c));
+        }
+        return ret;
+      }
+    };
+
+    struct string_run
+    {
+      static constexpr bool stops(u8 const c)
+      {
+        return c == '"' || c == '\\' || c >= 0x80;
+      }
+
+      template <typename V>
+      static typename V::block stops(typename V::block const b)
+      {
+        return V::either(V::lt(b, 0), V::either(V::eq(b, '"'), V::eq(b, '\\')));
+      }
+    };
+
+    struct comment_run
+    {
+      static constexpr bool stops(u8 const c)
+      {
+        return c == '\n' || c >= 0x80;
+      }
+
+      template <typename V>
+      static typename V::block stops(typename V::block const b)
+      {
+        return V::either(V::lt(b, 0), V::eq(b, '\n'));
+      }
+    };
+
+    struct whitespace_run
+    {
+      static constexpr bool stops(u8 const c)
+      {
+        return !(c == ' ' || c == ',' || (c >= '\t' && c <= '\r'));
+      }
+
+      template <typename V>
+      static typename V::block stops(typename V::block const b)
+      {
+        auto const space(V::either(
+          V::either(V::eq(b, ' '), V::eq(b, ',')),
+          V::either(V::either(V::eq(b, '\t'), V::eq(b, '\n')),
+                    V::either(V::either(V::eq(b, '\v'), V::eq(b, '\f')), V::eq(b, '\r')))));
+        return V::eq(space, 0);
+      }
+    };
+  }
+
+  /* ASCII symbol characters, which aren't whitespace or special to the reader. */
+  inline usize symbol(char const * const begin, char const * const end)
+  {
+    return detail::scan<detail::symbol_run>(begin, end);
+  }
+
+  /* ASCII string contents, up to a closing quote or an escape. */
+  inline usize string(char const * const begin, char const * const end)
+  {
+    return detail::scan<detail::string_run>(begin, end);
+  }
+
+  /* ASCII comment contents, up to the end of the line. */
+  inline usize comment(char const * const begin, char const * const end)
+  {
+    return detail::scan<detail::comment_run>(begin, end);
+  }
+
+  /* Whitespace, including commas. */
+  inline usize whitespace(char const * const begin, char const * const end)
+  {
+    return detail::scan<detail::whitespace_run>(begin, end);
+  }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <jtl/option.hpp>
+#include <jtl/result.hpp>
+
+#include <jank/read/source.hpp>
+#include <jank/runtime/object.hpp>
+
+/* A fast path for reading data, which goes straight from bytes to objects. There are no
+ * tokens, no per-form results, and no dynamic bindings. Collections are built in place and
+ * source metadata is optional, since data read from a config file or a fixture rarely needs
+ * to know where it came from.
+ *
+ * This only knows about the syntax which data uses. Everything else, such as quoting, reader
+ * conditionals, and any sort of invalid input, is left to the full lexer and parser, which
+ * also report any errors. When the data reader produces a form, it's the same form which the
+ * parser would have produced. */
+namespace jank::read::data
+{
+  /* The input needs the full parser. */
+  struct unsupported
+  {
+  };
+
+  struct reader
+  {
+    using result = jtl::result<jtl::option<runtime::object_ref>, unsupported>;
+
+    reader(native_persistent_string_view const &input, bool source_meta);
+
+    /* The next form, or none once the input is exhausted. Once this returns unsupported, the
+     * whole input needs to be read again with the parser. */
+    result next();
+
+  private:
+    result read_item(char closer);
+    jtl::result<runtime::object_ref, unsupported> read_required();
+    jtl::result<runtime::object_ref, unsupported> read_form();
+    jtl::result<runtime::object_ref, unsupported> read_list();
+    jtl::result<runtime::object_ref, unsupported> read_vector();
+    jtl::result<runtime::object_ref, unsupported> read_map();
+    jtl::result<runtime::object_ref, unsupported> read_set();
+    jtl::result<runtime::object_ref, unsupported> read_meta_hint();
+    jtl::result<runtime::object_ref, unsupported> read_symbolic_value();
+    jtl::result<runtime::object_ref, unsupported> read_string();
+    jtl::result<runtime::object_ref, unsupported> read_character();
+    jtl::result<runtime::object_ref, unsupported> read_atom();
+    jtl::result<runtime::object_ref, unsupported> read_lexed_atom(usize start);
+    jtl::result<runtime::object_ref, unsupported>
+    make_symbol(native_persistent_string_view const &s, usize start);
+    jtl::result<runtime::object_ref, unsupported>
+    make_keyword(native_persistent_string_view const &s);
+
+    void skip_space();
+    usize atom_end(usize from) const;
+    source_position position_at(usize offset);
+    /* Where the form at the current position starts, when we're keeping source metadata. */
+    source_position mark();
+    /* Source metadata for the form which started at start and ends at the current
+     * position, if we're keeping it. */
+    jtl::option<runtime::object_ref> meta_since(source_position const &start);
+
+    native_persistent_string_view input;
+    usize pos{};
+    bool source_meta{};
+    /* Atoms and strings need whitespace after them before the next atom or string. */
+    bool require_space{};
+    /* The last computed position. Positions are only computed for metadata, and they're
+     * always asked for in order, so each one picks up from the last. */
+    source_position cursor;
+  };
+
+  /* Reads every form in the input and returns the last one, or nil if there are none. */
+  jtl::result<runtime::object_ref, unsupported>
+  read_last(native_persistent_string_view const &input, bool source_meta);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <jtl/option.hpp>
+#include <jtl/result.hpp>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::read
+{
+  /* Reads top level data forms, one at a time, from input which arrives in chunks. Bytes are
+   * scanned just far enough to find where the next form ends, then only that form is read,
+   * and the bytes are dropped. So, no matter how large the input is, this holds
+   * onto at most the form being read and one chunk of input.
+   *
+   * This only reads data. Syntax which only makes sense for code, such as quoting, anonymous
+   * fns, var quotes, and reader conditionals, is an error, and nothing is ever evaluated. */
+  struct stream : gc_cleanup
+  {
+    /* Appends the next chunk of input to the buffer. Returns false once the input is
+     * exhausted. */
+    using source_fn = std::function<jtl::string_result<bool>(std::string &)>;
+
+    static constexpr usize chunk_size{ 64 * 1024 };
+
+    stream(source_fn &&source);
+    ~stream() override;
+
+    static jtl::string_result<stream *> open_file(jtl::immutable_string const &path);
+    static stream *from_string(jtl::immutable_string const &s);
+    /* Each call to the fn returns the next chunk, as a string, or nil at the end. This allows
+     * for reading from any source, such as a decompressor. */
+    static stream *from_fn(runtime::object_ref fn);
+
+    /* The next form, or none once the input is exhausted. */
+    jtl::string_result<jtl::option<runtime::object_ref>> next();
+
+    /* Closes the file, if there is one, and frees the buffered input. Nothing can be read
+     * afterward. */
+    void close();
+
+    /* Whether forms get source metadata, as they do from the parser. This can be changed
+     * between reads. */
+    bool source_meta{ true };
+
+  private:
+    jtl::string_result<bool> scan();
+    jtl::string_result<jtl::option<runtime::object_ref>> parse(usize end);
+    bool complete_form();
+
+    source_fn source;
+    /* The source only captures this stream, since anything else it captured could live
+     * outside of GC memory. What it reads from is kept here instead. */
+    runtime::object_ref chunk_fn;
+    int fd{ -1 };
+    bool exhausted{};
+    std::string buffer;
+    /* Everything before this has already been read. */
+    usize consumed{};
+
+    /* Where we are in the form being scanned. This carries over when the form doesn't end
+     * within the current buffer, so no byte is scanned twice. */
+    usize scanned{};
+    usize form_end{};
+    usize depth{};
+    /* How many more complete forms end the top level form. Discards and metadata each need
+     * one more form after them. */
+    usize needed{ 1 };
+    bool in_string{};
+    bool in_escape{};
+    bool in_comment{};
+    bool in_atom{};
+    /* Whether the top level atom being scanned is a tag, which prefixes a form. */
+    bool in_tag{};
+  };
+}
@@ -6,4 +6,10 @@ namespace jank::runtime::behavior
   concept derefable = requires(T * const t) {
     { t->deref() } -> std::convertible_to<object_ref>;
   };
+
+  /* Derefs which may block, giving up after a timeout in milliseconds. */
+  template <typename T>
+  concept blocking_derefable = requires(T * const t) {
+    { t->deref(object_ref{}, object_ref{}) } -> std::convertible_to<object_ref>;
+  };
 }
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace jank::runtime::behavior
+{
+  /* Values which are produced at some point after the object is made. */
+  template <typename T>
+  concept pending = requires(T const * const t) {
+    { t->is_realized() } -> std::convertible_to<bool>;
+  };
+}
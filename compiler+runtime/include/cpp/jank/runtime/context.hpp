@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <functional>
 
 #include <folly/Synchronized.h>
 
@@ -9,6 +10,7 @@
 #include <jank/runtime/module/loader.hpp>
 #include <jank/runtime/ns.hpp>
 #include <jank/runtime/var.hpp>
+#include <jank/runtime/detail/keyword_table.hpp>
 #include <jank/jit/processor.hpp>
 #include <jank/util/cli.hpp>
 
@@ -114,7 +116,7 @@ namespace jank::runtime
     obj::symbol unique_symbol(native_persistent_string_view const &prefix) const;
 
     folly::Synchronized<native_unordered_map<obj::symbol_ref, ns_ref>> namespaces;
-    folly::Synchronized<native_unordered_map<jtl::immutable_string, obj::keyword_ref>> keywords;
+    detail::keyword_table keywords;
 
     struct binding_scope
     {
@@ -130,7 +132,6 @@ namespace jank::runtime
     jtl::string_result<void> push_thread_bindings(obj::persistent_hash_map_ref const bindings);
     jtl::string_result<void> pop_thread_bindings();
     obj::persistent_hash_map_ref get_thread_bindings() const;
-    jtl::option<thread_binding_frame> current_thread_binding_frame();
 
     /* The analyze processor is reused across evaluations so we can keep the semantic information
      * of previous code. This is essential for REPL use. */
@@ -143,6 +144,11 @@ namespace jank::runtime
     jtl::immutable_string binary_cache_dir;
     module::loader module_loader;
 
+    /* When enabled, evaluated fns are interpreted instead of JIT compiled. An interpreted
+     * fn without captures is JIT compiled once it has been called this many times. */
+    bool interpreter_enabled{};
+    u32 interpreter_jit_threshold{};
+
     var_ref current_file_var;
     var_ref current_ns_var;
     var_ref in_ns_var;
@@ -150,12 +156,9 @@ namespace jank::runtime
     var_ref loaded_libs_var;
     var_ref current_module_var;
     var_ref assert_var;
+    var_ref agent_var;
     var_ref no_recur_var;
     var_ref gensym_env_var;
-
-    /* TODO: Remove this map. Just use the list. */
-    static thread_local native_unordered_map<context const *, std::list<thread_binding_frame>>
-      thread_binding_frames;
   };
 
   /* NOLINTNEXTLINE */
@@ -77,6 +77,9 @@ namespace jank::runtime
   object_ref get_thread_bindings();
 
   object_ref force(object_ref o);
+  /* Derefs which give up, returning the timeout val, after the timeout in milliseconds. */
+  object_ref blocking_deref(object_ref o, object_ref timeout_ms, object_ref timeout_val);
+  bool is_realized(object_ref o);
 
   object_ref tagged_literal(object_ref tag, object_ref form);
   bool is_tagged_literal(object_ref o);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime
+{
+  /* Vectors and hash maps can be split into pieces, without copying, which are then reduced
+   * in parallel on the work pool. */
+  bool is_foldable(object_ref o);
+
+  /* Reduces each piece of roughly n elements from `(combinef)` with reducef, then joins the
+   * pieces with `(combinef left right)`. Map entries are reduced with `(reducef acc k v)`.
+   * A reduced value only ends the reduction of its own piece. */
+  object_ref fold(object_ref n, object_ref combinef, object_ref reducef, object_ref coll);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+
+#include <folly/SharedMutex.h>
+
+#include <jank/runtime/obj/keyword.hpp>
+
+namespace jank::runtime::detail
+{
+  /* Keywords are interned by their ns and name, without joining them into one string. Lookups
+   * of existing keywords vastly outnumber inserts, so the table is split into shards, by hash,
+   * which each have their own reader/writer lock. Finding an existing keyword only takes a
+   * shared lock on one shard, so threads interning keywords don't serialize on each other. */
+  struct keyword_table
+  {
+    static constexpr usize shard_count{ 64 };
+
+    obj::keyword_ref intern(jtl::immutable_string const &ns, jtl::immutable_string const &name);
+
+  private:
+    struct key
+    {
+      bool operator==(key const &rhs) const;
+
+      jtl::immutable_string ns;
+      jtl::immutable_string name;
+      uhash hash{};
+    };
+
+    struct key_hash
+    {
+      usize operator()(key const &k) const noexcept
+      {
+        return k.hash;
+      }
+    };
+
+    /* Each shard gets its own cache line, so the locks don't contend through false sharing. */
+    struct alignas(64) shard
+    {
+      folly::SharedMutex mutex;
+      native_unordered_map<key, obj::keyword_ref, key_hash> keywords;
+    };
+
+    std::array<shard, shard_count> shards;
+  };
+}
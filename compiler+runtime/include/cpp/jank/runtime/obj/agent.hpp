@@ -0,0 +1,91 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using agent_ref = oref<struct agent>;
+
+  /* Agents apply actions to their state asynchronously, one at a time, in the order in which
+   * they were sent. Sends push onto a lock-free, multi-producer queue, so senders never
+   * block one another. Only the first send into an empty queue schedules the agent; from
+   * then on, the agent runs queued actions in batches on whichever executor they were sent
+   * to, until its queue is empty again. */
+  struct agent : gc
+  {
+    static constexpr object_type obj_type{ object_type::agent };
+    static constexpr bool pointer_free{ false };
+
+    enum class error_mode : u8
+    {
+      continue_,
+      fail
+    };
+
+    struct action : gc
+    {
+      std::atomic<action *> next{};
+      object_ref fn{};
+      object_ref args{};
+      object_ref bindings{};
+      /* Either :send, :send-off, or a fn which takes a thunk to run. */
+      object_ref executor{};
+    };
+
+    agent() = delete;
+    agent(object_ref state);
+
+    /* behavior::object_like */
+    bool equal(object const &) const;
+    jtl::immutable_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    jtl::immutable_string to_code_string() const;
+    uhash to_hash() const;
+
+    /* behavior::derefable */
+    object_ref deref() const;
+
+    /* Queues the action and returns immediately. Sends from within an action are held
+     * until that action completes. */
+    agent_ref dispatch(object_ref executor, object_ref fn, object_ref args);
+
+    /* Runs up to one batch of queued actions on the calling thread, which belongs to the
+     * given executor. Actions for other executors are left for the next batch. */
+    void drain(object_ref executor);
+
+    void set_validator(object_ref fn);
+    object_ref get_validator() const;
+    void set_error_handler(object_ref fn);
+    object_ref get_error_handler() const;
+    void set_error_mode(object_ref mode);
+    object_ref get_error_mode() const;
+    object_ref get_error() const;
+    object_ref restart(object_ref new_state, bool clear_actions);
+
+    /* Dispatches the sends held by the action running on this thread, rather than waiting
+     * for it to complete. Returns how many were dispatched. */
+    static usize release_pending_sends();
+    /* Further sends to any agent will throw. Running and queued actions still complete. */
+    static void shutdown();
+
+    object base{ obj_type };
+    std::atomic<object *> state{};
+    std::atomic<object *> validator{};
+    std::atomic<object *> error_handler{};
+    std::atomic<object *> error{};
+    std::atomic<error_mode> mode{ error_mode::fail };
+
+    /* The queue is intrusive: producers swap themselves in at the head and the single
+     * consumer, whichever thread is draining, walks from the tail. The tail is always a
+     * node which has already been run, or the initial stub. */
+    std::atomic<action *> head{};
+    action *tail{};
+    /* How many actions are queued but not yet run. A drain is scheduled whenever this goes
+     * up from zero, and only one drain is ever scheduled or running at once. */
+    std::atomic<usize> queued{};
+    /* Set when a failed agent stops draining. Restarting picks the queue back up. */
+    std::atomic<bool> parked{};
+    /* Sends made by the running action, which are dispatched once it completes. */
+    native_vector<std::pair<agent *, action *>> held_sends;
+  };
+}
@@ -6,6 +6,9 @@ namespace jank::runtime::obj
 {
   using array_chunk_ref = oref<struct array_chunk>;
 
+  /* A chunk either owns its buffer or is a view into elements owned by another object,
+   * such as a leaf of a persistent vector. Either way, nothing is copied when moving to the
+   * next element. */
   struct array_chunk : gc
   {
     static constexpr object_type obj_type{ object_type::array_chunk };
@@ -15,6 +18,8 @@ namespace jank::runtime::obj
     array_chunk(native_vector<object_ref> const &buffer);
     array_chunk(native_vector<object_ref> const &buffer, usize offset);
     array_chunk(native_vector<object_ref> &&buffer, usize offset);
+    /* The owner keeps [begin, end) alive for as long as this chunk is. */
+    array_chunk(object_ref owner, object_ref const *begin, object_ref const *end);
 
     /* behavior::object_like */
     bool equal(object const &) const;
@@ -32,6 +37,10 @@ namespace jank::runtime::obj
 
     object base{ obj_type };
     native_vector<object_ref> buffer;
+    object_ref owner;
+    /* Either the buffer's data or the owner's elements. */
+    object_ref const *items{};
     usize offset{};
+    usize size{};
   };
 }
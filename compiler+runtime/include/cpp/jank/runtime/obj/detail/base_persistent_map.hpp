@@ -44,6 +44,10 @@ namespace jank::runtime::obj::detail
     jtl::immutable_string to_code_string() const;
     uhash to_hash() const;
 
+    /* The entries hash for a map derived from this one, where the key is now mapped to the
+     * val, or removed with none. This is 0 if we haven't been hashed yet. */
+    uhash derived_hash(object_ref key, jtl::option<object_ref> const &val) const;
+
     /* behavior::seqable */
     oref<ST> seq() const;
     oref<ST> fresh_seq() const;
@@ -59,6 +63,9 @@ namespace jank::runtime::obj::detail
 
     object base{ PT::obj_type };
     jtl::option<object_ref> meta;
-    mutable uhash hash{};
+    /* The sum which our hash is mixed from. It's worked out the first time we're hashed and
+     * maps derived from us update it with only the entry which changed, so hashing each
+     * version of a map doesn't walk the whole thing. This is 0 until it's worked out. */
+    mutable uhash entries_hash{};
   };
 }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::read
+{
+  struct stream;
+}
+
+namespace jank::runtime::obj
+{
+  using form_stream_ref = oref<struct form_stream>;
+
+  /* A read::stream, as a jank object, so it can be handed to jank code and checked when it
+   * comes back. */
+  struct form_stream : gc
+  {
+    static constexpr object_type obj_type{ object_type::form_stream };
+    static constexpr bool pointer_free{ false };
+
+    form_stream() = default;
+    form_stream(read::stream *s);
+
+    /* behavior::object_like */
+    bool equal(object const &) const;
+    jtl::immutable_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    jtl::immutable_string to_code_string() const;
+    uhash to_hash() const;
+
+    /* The next form, or eof once the input is exhausted. Throws once the stream is closed. */
+    object_ref next(object_ref eof, bool source_meta);
+
+    /* Closes the underlying file, if there is one. Closing an already closed stream does
+     * nothing. */
+    void close();
+
+    object base{ obj_type };
+    read::stream *stream{};
+  };
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using future_ref = oref<struct future>;
+
+  /* A fn which runs on the global work pool, with the thread bindings which were in place
+   * when the future was made. Derefs block until the fn has finished and then return its
+   * result, or rethrow its error. */
+  struct future : gc
+  {
+    static constexpr object_type obj_type{ object_type::future };
+    static constexpr bool pointer_free{ false };
+
+    enum class future_state : u8
+    {
+      pending,
+      running,
+      done,
+      failed,
+      cancelled
+    };
+
+    future() = default;
+    future(object_ref fn, object_ref bindings);
+
+    /* Makes a future for the fn and submits it to the global work pool. */
+    static future_ref submit(object_ref fn, object_ref bindings);
+
+    /* behavior::object_like */
+    bool equal(object const &) const;
+    jtl::immutable_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    jtl::immutable_string to_code_string() const;
+    uhash to_hash() const;
+
+    /* behavior::derefable */
+    object_ref deref();
+
+    /* behavior::blocking_derefable */
+    object_ref deref(object_ref timeout_ms, object_ref timeout_val);
+
+    /* behavior::pending */
+    bool is_realized() const;
+
+    /* Runs the fn on the calling thread, unless another thread has already started it
+     * or it has been cancelled. */
+    void run();
+    /* Only futures which haven't started yet can be cancelled. */
+    bool cancel();
+    bool is_cancelled() const;
+
+    object base{ obj_type };
+    object_ref fn{};
+    object_ref bindings{};
+    object_ref val{};
+    object_ref error{};
+    std::atomic<future_state> state{ future_state::pending };
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+}
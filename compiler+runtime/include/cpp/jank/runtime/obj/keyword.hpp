@@ -50,6 +50,9 @@ namespace jank::runtime::obj
 
     object base{ obj_type };
     symbol_ref sym;
+    /* Keywords are hashed on every map lookup they're used in, so the hash is worked out
+     * once, when the keyword is interned. */
+    uhash hash{};
   };
 }
 
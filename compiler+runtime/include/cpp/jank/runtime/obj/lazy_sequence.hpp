@@ -10,7 +10,6 @@ namespace jank::runtime::obj
   using cons_ref = oref<struct cons>;
   using lazy_sequence_ref = oref<struct lazy_sequence>;
 
-  /* TODO: IPending analog, to implement `realized?`. */
   struct lazy_sequence : gc
   {
     static constexpr object_type obj_type{ object_type::lazy_sequence };
@@ -45,6 +44,9 @@ namespace jank::runtime::obj
     /* behavior::metadatable */
     lazy_sequence_ref with_meta(object_ref m) const;
 
+    /* behavior::pending */
+    bool is_realized() const;
+
   private:
     object_ref resolve_fn() const;
     object_ref resolve_seq() const;
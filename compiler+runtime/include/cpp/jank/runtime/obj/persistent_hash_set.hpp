@@ -73,5 +73,9 @@ namespace jank::runtime::obj
     object base{ obj_type };
     value_type data;
     jtl::option<object_ref> meta;
+    /* The sum which our hash is mixed from. It's worked out the first time we're hashed and
+     * sets derived from us update it with only the item which was added or removed. This is
+     * 0 until it's worked out. */
+    mutable uhash items_hash{};
   };
 }
@@ -88,6 +88,10 @@ namespace jank::runtime::obj
     object base{ obj_type };
     value_type data;
     jtl::option<object_ref> meta;
-    mutable uhash hash{};
+    /* The sum which our hash is mixed from. It's worked out the first time we're hashed and
+     * vectors conj'd or popped from us update it with only the item at the end, so hashing
+     * each version of a growing vector doesn't walk the whole thing. This is 0 until it's
+     * worked out. */
+    mutable uhash items_hash{};
   };
 }
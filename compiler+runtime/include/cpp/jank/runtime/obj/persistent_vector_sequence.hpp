@@ -5,6 +5,7 @@
 namespace jank::runtime::obj
 {
   using cons_ref = oref<struct cons>;
+  using array_chunk_ref = oref<struct array_chunk>;
   using persistent_vector_ref = oref<struct persistent_vector>;
   using persistent_vector_sequence_ref = oref<struct persistent_vector_sequence>;
 
@@ -42,6 +43,11 @@ namespace jank::runtime::obj
     /* behavior::sequenceable_in_place */
     persistent_vector_sequence_ref next_in_place();
 
+    /* behavior::chunkable */
+    /* The chunk is a view of the rest of the leaf which holds the current element. */
+    array_chunk_ref chunked_first() const;
+    persistent_vector_sequence_ref chunked_next() const;
+
     object base{ obj_type };
     obj::persistent_vector_ref vec{};
     usize index{};
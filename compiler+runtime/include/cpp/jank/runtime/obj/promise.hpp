@@ -0,0 +1,50 @@
+#pragma once
+
+#include <condition_variable>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using promise_ref = oref<struct promise>;
+
+  /* A value which is delivered once, by any thread. Derefs block until it's delivered. */
+  struct promise : gc
+  {
+    static constexpr object_type obj_type{ object_type::promise };
+    static constexpr bool pointer_free{ false };
+
+    promise() = default;
+
+    /* behavior::object_like */
+    bool equal(object const &) const;
+    jtl::immutable_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    jtl::immutable_string to_code_string() const;
+    uhash to_hash() const;
+
+    /* behavior::derefable */
+    object_ref deref();
+
+    /* behavior::blocking_derefable */
+    object_ref deref(object_ref timeout_ms, object_ref timeout_val);
+
+    /* behavior::pending */
+    bool is_realized() const;
+
+    /* Returns this promise if the value was delivered, or nil if it had already been
+     * delivered before. */
+    object_ref deliver(object_ref o);
+
+    /* behavior::callable
+     *
+     * Calling a promise delivers it, same as in Clojure. */
+    object_ref call(object_ref o);
+
+    object base{ obj_type };
+    object_ref val{};
+    std::atomic<bool> delivered{};
+    std::mutex mutex;
+    std::condition_variable delivery;
+  };
+}
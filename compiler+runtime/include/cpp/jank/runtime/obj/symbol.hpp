@@ -14,7 +14,7 @@ namespace jank::runtime::obj
     static constexpr object_type obj_type{ object_type::symbol };
     static constexpr bool pointer_free{ false };
 
-    symbol() = default;
+    symbol();
     symbol(symbol &&) noexcept = default;
     symbol(symbol const &) = default;
     symbol(jtl::immutable_string const &d);
@@ -63,7 +63,8 @@ namespace jank::runtime::obj
     jtl::immutable_string name;
 
     jtl::option<object_ref> meta;
-    mutable uhash hash{};
+    /* Worked out whenever the ns or name is set. */
+    uhash hash{};
   };
 }
 
@@ -69,11 +69,15 @@ namespace jank::runtime
     multi_function,
 
     native_pointer_wrapper,
+    form_stream,
 
     atom,
     volatile_,
     reduced,
     delay,
+    future,
+    promise,
+    agent,
     ns,
 
     var,
@@ -191,6 +195,8 @@ namespace jank::runtime
 
       case object_type::native_pointer_wrapper:
         return "native_pointer_wrapper";
+      case object_type::form_stream:
+        return "form_stream";
 
       case object_type::atom:
         return "atom";
@@ -200,6 +206,12 @@ namespace jank::runtime
         return "reduced";
       case object_type::delay:
         return "delay";
+      case object_type::future:
+        return "future";
+      case object_type::promise:
+        return "promise";
+      case object_type::agent:
+        return "agent";
       case object_type::ns:
         return "ns";
 
@@ -5,4 +5,6 @@
 namespace jank::runtime::perf
 {
   object_ref benchmark(object_ref opts, object_ref f);
+  object_ref start_sampling(object_ref frequency);
+  object_ref stop_sampling();
 }
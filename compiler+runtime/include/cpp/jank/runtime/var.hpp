@@ -1,15 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 
-#include <folly/Synchronized.h>
-
 #include <jtl/result.hpp>
 #include <jank/runtime/object.hpp>
 #include <jank/runtime/obj/symbol.hpp>
 
 namespace jank::runtime
 {
+  struct context;
   using ns_ref = oref<struct ns>;
   using var_ref = oref<struct var>;
   using var_thread_binding_ref = oref<struct var_thread_binding>;
@@ -48,9 +48,18 @@ namespace jank::runtime
     var_ref with_meta(object_ref m);
 
     bool is_bound() const;
-    object_ref get_root() const;
+
+    /* Reading the root is lock free, since it's on the path of nearly every fn call. This is
+     * defined here so that JIT compiled code can inline it. */
+    object_ref get_root() const
+    {
+      return root.load(std::memory_order_acquire);
+    }
+
     /* Binding a root changes it for all threads. */
     var_ref bind_root(object_ref r);
+    /* If another thread changes the root while `f` is running, `f` will be applied again
+     * to the new root. So `f` should be free of side effects. */
     object_ref alter_root(object_ref f, object_ref args);
     /* Setting a var does not change its root, it only affects the current thread
      * binding. If there is no thread binding, a var cannot be set. */
@@ -75,11 +84,15 @@ namespace jank::runtime
     mutable uhash hash{};
 
   private:
-    folly::Synchronized<object_ref> root;
+    /* Roots are published with release stores and read with acquire loads. */
+    std::atomic<object *> root;
 
   public:
     std::atomic_bool dynamic{ false };
     std::atomic_bool thread_bound{ false };
+    /* Assigned the first time this var is thread bound. This is the var's slot in each
+     * thread's binding stack. Zero means it has never been bound. */
+    std::atomic<u32> binding_index{};
   };
 
   struct var_thread_binding : gc
@@ -101,9 +114,42 @@ namespace jank::runtime
     std::thread::id thread_id;
   };
 
-  struct thread_binding_frame
+  /* Each thread has a flat array of binding slots, indexed by var, which always holds the
+   * innermost binding for each var. Pushing a frame saves the slots it replaces, so popping
+   * the frame just puts them back. Looking up a var's binding is then just an index and
+   * push/pop only touch the vars being bound. */
+  struct thread_binding_stack
   {
-    obj::persistent_hash_map_ref bindings{};
+    struct slot
+    {
+      var *bound_var{};
+      var_thread_binding *binding{};
+    };
+
+    struct saved_slot
+    {
+      u32 index{};
+      slot previous;
+    };
+
+    struct frame
+    {
+      context const *rt_ctx{};
+      usize saved_offset{};
+    };
+
+    /* The stack for the current thread. */
+    static thread_binding_stack &current();
+
+    jtl::string_result<void> push(context const *rt_ctx, obj::persistent_hash_map_ref bindings);
+    jtl::string_result<void> pop(context const *rt_ctx);
+    /* Builds a map of every var bound on this thread to its binding. This is slow, but it's
+     * only needed for conveying bindings to other threads. */
+    obj::persistent_hash_map_ref to_map() const;
+
+    native_vector<slot> slots;
+    native_vector<saved_slot> saved;
+    native_vector<frame> frames;
   };
 
   struct var_unbound_root : gc
@@ -39,6 +39,7 @@
 #include <jank/runtime/obj/multi_function.hpp>
 #include <jank/runtime/obj/native_function_wrapper.hpp>
 #include <jank/runtime/obj/native_pointer_wrapper.hpp>
+#include <jank/runtime/obj/form_stream.hpp>
 #include <jank/runtime/obj/persistent_vector_sequence.hpp>
 #include <jank/runtime/obj/persistent_string_sequence.hpp>
 #include <jank/runtime/obj/persistent_list_sequence.hpp>
@@ -49,6 +50,9 @@
 #include <jank/runtime/obj/atom.hpp>
 #include <jank/runtime/obj/volatile.hpp>
 #include <jank/runtime/obj/delay.hpp>
+#include <jank/runtime/obj/future.hpp>
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/obj/agent.hpp>
 #include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/obj/tagged_literal.hpp>
 #include <jank/runtime/ns.hpp>
@@ -297,6 +301,11 @@ namespace jank::runtime
                     std::forward<Args>(args)...);
         }
         break;
+      case object_type::form_stream:
+        {
+          return fn(expect_object<obj::form_stream>(erased), std::forward<Args>(args)...);
+        }
+        break;
       case object_type::jit_function:
         {
           return fn(expect_object<obj::jit_function>(erased), std::forward<Args>(args)...);
@@ -332,6 +341,21 @@ namespace jank::runtime
           return fn(expect_object<obj::delay>(erased), std::forward<Args>(args)...);
         }
         break;
+      case object_type::future:
+        {
+          return fn(expect_object<obj::future>(erased), std::forward<Args>(args)...);
+        }
+        break;
+      case object_type::promise:
+        {
+          return fn(expect_object<obj::promise>(erased), std::forward<Args>(args)...);
+        }
+        break;
+      case object_type::agent:
+        {
+          return fn(expect_object<obj::agent>(erased), std::forward<Args>(args)...);
+        }
+        break;
       case object_type::ns:
         {
           return fn(expect_object<ns>(erased), std::forward<Args>(args)...);
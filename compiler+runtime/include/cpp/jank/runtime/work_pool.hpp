@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <jtl/option.hpp>
+
+#include <jank/type.hpp>
+
+namespace jank::runtime
+{
+  /* A fixed size pool of worker threads, each of which has its own deque of work. Workers
+   * take work from the back of their own deque, which keeps recently submitted (and likely
+   * cache hot) work local, and they steal from the front of each other's deques once theirs
+   * is empty. Work submitted from outside of the pool is spread across the workers.
+   *
+   * Every worker is registered with the GC, so work may allocate and hold onto GC objects
+   * like any other thread. The workers, and their deques, are in uncollectable GC memory,
+   * so GC references captured by queued work stay visible to the GC until it runs.
+   *
+   * A pool lives until the process exits and its workers are detached, so work which never
+   * finishes, such as a future which is blocked forever, can't hold up exiting. */
+  struct work_pool
+  {
+    using work = std::function<void()>;
+
+    work_pool(usize thread_count);
+    work_pool(work_pool const &) = delete;
+    work_pool(work_pool &&) = delete;
+    ~work_pool() = delete;
+
+    /* The shared pool used for futures and other parallel work. It's sized to the number
+     * of hardware threads and started the first time it's needed. */
+    static work_pool &global();
+
+    void submit(work &&w);
+
+    /* Runs one unit of queued work on the calling thread, if there is any. Threads which
+     * are waiting on work in this pool can use this to make progress, rather than block. */
+    bool help();
+
+    usize size() const;
+
+  private:
+    struct worker
+    {
+      std::mutex mutex;
+      native_deque<work> queue;
+    };
+
+    void run(usize index);
+    jtl::option<work> take(usize index);
+    jtl::option<work> steal(usize thief);
+
+    worker *workers{};
+    usize worker_count{};
+    std::atomic<usize> next_worker{};
+
+    /* Idle workers sleep on this until there's pending work. */
+    std::mutex idle_mutex;
+    std::condition_variable idle_cv;
+    std::atomic<usize> pending{};
+  };
+
+  /* A pool for work which may block, such as futures and send-off actions. A fixed size
+   * pool can have every worker blocked, on a promise or on IO, which starves everything
+   * queued behind them. Instead, a thread is started whenever there's more queued work than
+   * idle threads, and threads which have been idle for a minute exit.
+   *
+   * Like the work pool, threads are registered with the GC and detached, and the pool is
+   * never destroyed. */
+  struct growing_pool
+  {
+    growing_pool();
+    growing_pool(growing_pool const &) = delete;
+    growing_pool(growing_pool &&) = delete;
+    ~growing_pool() = delete;
+
+    /* The shared pool used for futures and send-off. */
+    static growing_pool &global();
+
+    void submit(work_pool::work &&w);
+
+    /* The number of threads which are currently alive. */
+    usize size() const;
+
+  private:
+    void run();
+
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    native_deque<work_pool::work> queue;
+    usize idle{};
+    usize threads{};
+  };
+}
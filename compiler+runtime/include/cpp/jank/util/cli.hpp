@@ -10,7 +10,8 @@ namespace jank::util::cli
     compile,
     repl,
     cpp_repl,
-    run_main
+    run_main,
+    profile_report
   };
 
   struct options
@@ -19,8 +20,14 @@ namespace jank::util::cli
     native_transient_string module_path;
     bool profiler_enabled{};
     native_transient_string profiler_file{ "jank.profile" };
+    native_transient_string profile_sample_file;
+    u32 profile_sample_frequency{ 999 };
     bool gc_incremental{};
 
+    /* Evaluation. */
+    bool interpreter_enabled{};
+    u32 interpreter_jit_threshold{ 100 };
+
     /* Native dependencies. */
     native_vector<jtl::immutable_string> include_dirs;
     native_vector<jtl::immutable_string> library_dirs;
@@ -29,6 +36,9 @@ namespace jank::util::cli
 
     /* Compilation. */
     i64 optimization_level{};
+    bool lazy_jit{ true };
+    bool jit_cache{};
+    u32 tier_up_threshold{ 1000 };
 
     /* Run command. */
     native_transient_string target_file;
@@ -43,6 +53,9 @@ namespace jank::util::cli
     /* Run main command. */
     native_transient_string target_module;
 
+    /* Profile report command. */
+    native_transient_string profile_report_file;
+
     /* Extras.
      * TODO: Use a native_persistent_vector instead.
      * */
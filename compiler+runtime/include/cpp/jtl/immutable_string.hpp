@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <bit>
 
 #include <jtl/primitive.hpp>
@@ -681,13 +682,30 @@ namespace jtl
         return store.hash;
       }
 
-      /* https://github.com/openjdk/jdk/blob/7e30130e354ebfed14617effd2a517ab2f4140a5/src/java.base/share/classes/java/lang/StringLatin1.java#L194 */
+      /* https://github.com/openjdk/jdk/blob/7e30130e354ebfed14617effd2a517ab2f4140a5/src/java.base/share/classes/java/lang/StringLatin1.java#L194
+       *
+       * That's h = 31 * h + c for each byte, which makes every byte wait on the last. Instead,
+       * we take a block of bytes at a time, as h * 31^n + c0 * 31^(n - 1) + ... + c(n - 1).
+       * The bytes within a block don't depend on each other, so the compiler can vectorize
+       * them, and the result is exactly the same. */
       auto const ptr(data());
-      for(size_type i{}; i != size(); ++i)
+      auto const length(size());
+      uhash h{};
+      size_type i{};
+      for(; length - i >= hash_block_size; i += hash_block_size)
+      {
+        uhash block{};
+        for(size_type j{}; j != hash_block_size; ++j)
+        {
+          block += static_cast<uhash>(ptr[i + j] & 0xff) * hash_powers[hash_block_size - 1 - j];
+        }
+        h = h * hash_powers[hash_block_size] + block;
+      }
+      for(; i != length; ++i)
       {
-        store.hash = 31 * store.hash + (ptr[i] & 0xff);
+        h = 31 * h + (ptr[i] & 0xff);
       }
-      return store.hash = jank::hash::integer(store.hash);
+      return store.hash = jank::hash::integer(h);
     }
 
     /*** Conversions. ***/
@@ -699,6 +717,18 @@ namespace jtl
   private:
     static constexpr bool is_little_endian{ std::endian::native == std::endian::little };
 
+    static constexpr size_type hash_block_size{ 16 };
+    /* 31^n, for each n up to the block size, wrapping just as the hash does. */
+    static constexpr auto hash_powers{ [] {
+      std::array<uhash, hash_block_size + 1> ret{};
+      ret[0] = 1;
+      for(size_type i{ 1 }; i != ret.size(); ++i)
+      {
+        ret[i] = ret[i - 1] * 31;
+      }
+      return ret;
+    }() };
+
     enum class category : u8
     {
       small = 0,
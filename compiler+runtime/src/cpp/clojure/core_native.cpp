@@ -1,7 +1,10 @@
+#include <thread>
+
 #include <clojure/core_native.hpp>
 #include <jank/runtime/convert/function.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/fold.hpp>
 #include <jank/runtime/core/meta.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/behavior/callable.hpp>
@@ -114,6 +117,122 @@ namespace clojure::core_native
     return make_box<obj::delay>(fn);
   }
 
+  static object_ref future_call(object_ref const fn)
+  {
+    /* Conveying no bindings is common, so we don't bother pushing an empty frame. */
+    object_ref conveyed{};
+    auto const bindings(__rt_ctx->get_thread_bindings());
+    if(bindings->count() != 0)
+    {
+      conveyed = bindings;
+    }
+    return obj::future::submit(fn, conveyed);
+  }
+
+  static object_ref is_future(object_ref const o)
+  {
+    return make_box(o->type == object_type::future);
+  }
+
+  static object_ref is_future_done(object_ref const o)
+  {
+    return make_box(try_object<obj::future>(o)->is_realized());
+  }
+
+  static object_ref future_cancel(object_ref const o)
+  {
+    return make_box(try_object<obj::future>(o)->cancel());
+  }
+
+  static object_ref is_future_cancelled(object_ref const o)
+  {
+    return make_box(try_object<obj::future>(o)->is_cancelled());
+  }
+
+  static object_ref promise()
+  {
+    return make_box<obj::promise>();
+  }
+
+  static object_ref deliver(object_ref const p, object_ref const o)
+  {
+    return try_object<obj::promise>(p)->deliver(o);
+  }
+
+  static object_ref available_processors()
+  {
+    return make_box(static_cast<i64>(std::max(1u, std::thread::hardware_concurrency())));
+  }
+
+  static object_ref agent(object_ref const state)
+  {
+    return make_box<obj::agent>(state);
+  }
+
+  static object_ref agent_dispatch(object_ref const a,
+                                   object_ref const executor,
+                                   object_ref const fn,
+                                   object_ref const args)
+  {
+    return try_object<obj::agent>(a)->dispatch(executor, fn, args);
+  }
+
+  static object_ref agent_error(object_ref const a)
+  {
+    return try_object<obj::agent>(a)->get_error();
+  }
+
+  static object_ref
+  restart_agent(object_ref const a, object_ref const new_state, object_ref const clear_actions)
+  {
+    return try_object<obj::agent>(a)->restart(new_state, truthy(clear_actions));
+  }
+
+  static object_ref set_error_handler(object_ref const a, object_ref const fn)
+  {
+    try_object<obj::agent>(a)->set_error_handler(fn);
+    return jank_nil;
+  }
+
+  static object_ref error_handler(object_ref const a)
+  {
+    return try_object<obj::agent>(a)->get_error_handler();
+  }
+
+  static object_ref set_error_mode(object_ref const a, object_ref const mode)
+  {
+    try_object<obj::agent>(a)->set_error_mode(mode);
+    return jank_nil;
+  }
+
+  static object_ref error_mode(object_ref const a)
+  {
+    return try_object<obj::agent>(a)->get_error_mode();
+  }
+
+  /* TODO: Validators for atoms, vars and refs. */
+  static object_ref set_validator(object_ref const a, object_ref const fn)
+  {
+    try_object<obj::agent>(a)->set_validator(fn);
+    return jank_nil;
+  }
+
+  static object_ref get_validator(object_ref const a)
+  {
+    return try_object<obj::agent>(a)->get_validator();
+  }
+
+  static object_ref release_pending_sends()
+  {
+    return make_box(static_cast<i64>(obj::agent::release_pending_sends()));
+  }
+
+  static object_ref shutdown_agents()
+  {
+    obj::agent::shutdown();
+    return jank_nil;
+  }
+
   static object_ref is_fn(object_ref const o)
   {
     return make_box(o->type == object_type::native_function_wrapper
@@ -475,6 +594,30 @@ jank_object_ref jank_load_clojure_core_native()
   intern_fn("iterate", &iterate);
   intern_fn("delay*", &core_native::delay);
   intern_fn("force", &force);
+  intern_fn("blocking-deref", &blocking_deref);
+  intern_fn("realized?", &is_realized);
+  intern_fn("future-call", &core_native::future_call);
+  intern_fn("future?", &core_native::is_future);
+  intern_fn("future-done?", &core_native::is_future_done);
+  intern_fn("future-cancel", &core_native::future_cancel);
+  intern_fn("future-cancelled?", &core_native::is_future_cancelled);
+  intern_fn("promise", &core_native::promise);
+  intern_fn("deliver", &core_native::deliver);
+  intern_fn("available-processors", &core_native::available_processors);
+  intern_fn("foldable?", &is_foldable);
+  intern_fn("fold", &fold);
+  intern_fn("agent", &core_native::agent);
+  intern_fn("agent-dispatch", &core_native::agent_dispatch);
+  intern_fn("agent-error", &core_native::agent_error);
+  intern_fn("restart-agent", &core_native::restart_agent);
+  intern_fn("set-error-handler!", &core_native::set_error_handler);
+  intern_fn("error-handler", &core_native::error_handler);
+  intern_fn("set-error-mode!", &core_native::set_error_mode);
+  intern_fn("error-mode", &core_native::error_mode);
+  intern_fn("set-validator!", &core_native::set_validator);
+  intern_fn("get-validator", &core_native::get_validator);
+  intern_fn("release-pending-sends", &core_native::release_pending_sends);
+  intern_fn("shutdown-agents", &core_native::shutdown_agents);
   intern_fn("ifn?", &is_callable);
   intern_fn("fn?", &core_native::is_fn);
   intern_fn("multi-fn?", &core_native::is_multi_fn);
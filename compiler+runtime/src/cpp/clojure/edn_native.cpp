@@ -0,0 +1,80 @@
+#include <clojure/edn_native.hpp>
+#include <jank/read/stream.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/form_stream.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/convert/function.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace clojure::edn_native
+{
+  using namespace jank;
+  using namespace jank::runtime;
+
+  static object_ref wrap(read::stream * const s)
+  {
+    return make_box<obj::form_stream>(s);
+  }
+
+  static object_ref file_reader(object_ref const path)
+  {
+    auto const res(read::stream::open_file(runtime::to_string(path)));
+    if(res.is_err())
+    {
+      throw std::runtime_error{ res.expect_err().c_str() };
+    }
+    return wrap(res.expect_ok());
+  }
+
+  static object_ref string_reader(object_ref const s)
+  {
+    return wrap(read::stream::from_string(runtime::to_string(s)));
+  }
+
+  static object_ref fn_reader(object_ref const fn)
+  {
+    return wrap(read::stream::from_fn(fn));
+  }
+
+  static object_ref
+  read_next(object_ref const reader, object_ref const eof, object_ref const source_meta)
+  {
+    return try_object<obj::form_stream>(reader)->next(eof, truthy(source_meta));
+  }
+
+  static object_ref close(object_ref const reader)
+  {
+    try_object<obj::form_stream>(reader)->close();
+    return jank_nil;
+  }
+}
+
+jank_object_ref jank_load_clojure_edn_native()
+{
+  using namespace jank;
+  using namespace jank::runtime;
+  using namespace clojure;
+
+  auto const ns(__rt_ctx->intern_ns("clojure.edn-native"));
+
+  auto const intern_fn([=](jtl::immutable_string const &name, auto const fn) {
+    ns->intern_var(name)->bind_root(
+      make_box<obj::native_function_wrapper>(convert_function(fn))
+        ->with_meta(obj::persistent_hash_map::create_unique(std::make_pair(
+          __rt_ctx->intern_keyword("name").expect_ok(),
+          make_box(obj::symbol{ __rt_ctx->current_ns()->to_string(), name }.to_string())))));
+  });
+
+  intern_fn("file-reader", &edn_native::file_reader);
+  intern_fn("string-reader", &edn_native::string_reader);
+  intern_fn("fn-reader", &edn_native::fn_reader);
+  intern_fn("read-next", &edn_native::read_next);
+  intern_fn("close", &edn_native::close);
+
+  return jank_nil.erase();
+}
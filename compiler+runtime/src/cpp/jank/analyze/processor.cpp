@@ -16,6 +16,8 @@
 #include <jank/runtime/core/seq.hpp>
 #include <jank/analyze/processor.hpp>
 #include <jank/analyze/step/force_boxed.hpp>
+#include <jank/analyze/step/escape.hpp>
+#include <jank/analyze/step/fold.hpp>
 #include <jank/evaluate.hpp>
 #include <jtl/result.hpp>
 #include <jank/util/scope_exit.hpp>
@@ -955,9 +957,13 @@ namespace jank::analyze
         return res.expect_err_move();
       }
       auto it(ret->pairs.emplace_back(sym, res.expect_ok_move()));
-      ret->frame->locals.emplace(
+      auto const emplaced(ret->frame->locals.emplace(
         sym,
-        local_binding{ sym, it.second, current_frame, it.second->needs_box });
+        local_binding{ sym, it.second, current_frame, it.second->needs_box }));
+      if(!emplaced.second)
+      {
+        emplaced.first->second.rebound = true;
+      }
     }
 
     usize const form_count{ o->count() - 2 };
@@ -981,6 +987,8 @@ namespace jank::analyze
       ret->body->values.emplace_back(res.expect_ok_move());
     }
 
+    step::mark_non_escaping(ret);
+
     return ret;
   }
 
@@ -1210,6 +1218,12 @@ namespace jank::analyze
      *   ((fn* [a b]
      *     (+ a b)) a b))
      * ```
+     *
+     * One cost of this is that loop bindings are always boxed, even when their values are
+     * unboxed, since they become fn params, which are always objects, and recur is a call.
+     * Math within the loop body can still be unboxed, but each recur boxes its args again.
+     * Keeping them unboxed needs the loop to be lowered to a real loop in codegen, rather
+     * than a fn.
      */
     runtime::detail::native_persistent_list const args{ binding_syms.rbegin(),
                                                         binding_syms.rend() };
@@ -1857,10 +1871,12 @@ namespace jank::analyze
           /* If we don't have a valid var_deref, we know the var exists, but we
            * don't have an AST node for it. This means the var came in through
            * a pre-compiled module. In that case, we can only rely on meta to
-           * tell us what we need. */
+           * tell us what we need. The same goes for vars which just alias a native
+           * fn, like inc. */
           if(fn_res != vars.end())
           {
-            if(fn_res->second.data->kind != expression_kind::function)
+            auto const kind(fn_res->second.data->kind);
+            if(kind != expression_kind::function && kind != expression_kind::var_deref)
             {
               return error::internal_analyze_failure("Unsupported arity meta on non-function var.",
                                                      object_source(first),
@@ -1946,12 +1962,49 @@ namespace jank::analyze
     }
     else
     {
-      return jtl::make_ref<expr::call>(position,
-                                       current_frame,
-                                       needs_ret_box,
-                                       source.as_ref(),
-                                       o,
-                                       std::move(arg_exprs));
+      auto const ret(jtl::make_ref<expr::call>(position,
+                                               current_frame,
+                                               needs_ret_box,
+                                               source.as_ref(),
+                                               o,
+                                               std::move(arg_exprs)));
+
+      /* If we're calling a var which we've seen def'd to a fn, and that fn has a fixed
+       * arity which matches this call, codegen can call that arity directly. The var
+       * may be rebound later, so this is only a hint; codegen still needs to guard on
+       * the var's current root. Dynamic vars are skipped, since they're so often rebound. */
+      auto const var_deref(llvm::dyn_cast<expr::var_deref>(source.data));
+      if(var_deref && !var_deref->var->dynamic.load() && arg_count <= runtime::max_params)
+      {
+        auto const found_var(vars.find(var_deref->var));
+        auto const fn(found_var == vars.end()
+                        ? nullptr
+                        : llvm::dyn_cast<expr::function>(found_var->second.data));
+        if(fn && fn->captures().empty())
+        {
+          for(auto const &arity : fn->arities)
+          {
+            if(!arity.fn_ctx->is_variadic && arity.fn_ctx->param_count == arg_count)
+            {
+              ret->direct_fn = fn;
+              break;
+            }
+          }
+        }
+      }
+
+      if(auto const folded{ step::fold_call(ret) }; folded.is_some())
+      {
+        return folded.unwrap();
+      }
+
+      /* A fn which is immediately called, like `((fn [] ...))`, can't escape this call. */
+      if(auto const fn{ llvm::dyn_cast<expr::function>(source.data) }; fn)
+      {
+        fn->escapes = false;
+      }
+
+      return ret;
     }
   }
 
@@ -0,0 +1,194 @@
+#include <algorithm>
+
+#include <jank/analyze/step/escape.hpp>
+#include <jank/analyze/local_frame.hpp>
+#include <jank/analyze/visit.hpp>
+
+namespace jank::analyze::step
+{
+  struct escape_state
+  {
+    runtime::obj::symbol_ref name;
+    local_binding_ptr binding;
+    /* How many fns deep we are, relative to the let. Any reference from within a nested
+     * fn counts as an escape, since that fn may itself outlive the let. */
+    usize fn_depth{};
+    bool escapes{};
+  };
+
+  static void walk(expression_ref expr, escape_state &state);
+
+  static void walk(expr::do_ref const do_, escape_state &state)
+  {
+    for(auto const &value : do_->values)
+    {
+      walk(value, state);
+    }
+  }
+
+  static void walk(native_vector<expression_ref> const &exprs, escape_state &state)
+  {
+    for(auto const &e : exprs)
+    {
+      walk(e, state);
+    }
+  }
+
+  static bool is_callee_reference(expr::call_ref const call, escape_state const &state)
+  {
+    auto const local(llvm::dyn_cast<expr::local_reference>(call->source_expr.data));
+    return local && state.fn_depth == 0 && local->binding == state.binding;
+  }
+
+  static void walk(expression_ref const expr, escape_state &state)
+  {
+    if(state.escapes)
+    {
+      return;
+    }
+
+    visit_expr(
+      [&](auto const typed_expr) {
+        using T = typename std::decay_t<decltype(typed_expr)>::value_type;
+
+        if constexpr(std::same_as<T, expr::local_reference>)
+        {
+          /* We compare by name, rather than binding, since captures within nested fns
+           * don't necessarily share our binding. Being conservative here is fine. */
+          if(typed_expr->name->equal(*state.name))
+          {
+            state.escapes = true;
+          }
+        }
+        else if constexpr(std::same_as<T, expr::call>)
+        {
+          if(!is_callee_reference(typed_expr, state))
+          {
+            walk(typed_expr->source_expr, state);
+          }
+          walk(typed_expr->arg_exprs, state);
+        }
+        else if constexpr(std::same_as<T, expr::def>)
+        {
+          if(typed_expr->value.is_some())
+          {
+            walk(typed_expr->value.unwrap(), state);
+          }
+        }
+        else if constexpr(std::same_as<T, expr::list> || std::same_as<T, expr::vector>
+                          || std::same_as<T, expr::set>)
+        {
+          walk(typed_expr->data_exprs, state);
+        }
+        else if constexpr(std::same_as<T, expr::map>)
+        {
+          for(auto const &pair : typed_expr->data_exprs)
+          {
+            walk(pair.first, state);
+            walk(pair.second, state);
+          }
+        }
+        else if constexpr(std::same_as<T, expr::function>)
+        {
+          ++state.fn_depth;
+          for(auto const &arity : typed_expr->arities)
+          {
+            walk(arity.body, state);
+          }
+          --state.fn_depth;
+        }
+        else if constexpr(std::same_as<T, expr::recur> || std::same_as<T, expr::named_recursion>)
+        {
+          walk(typed_expr->arg_exprs, state);
+        }
+        else if constexpr(std::same_as<T, expr::let>)
+        {
+          for(auto const &pair : typed_expr->pairs)
+          {
+            walk(pair.second, state);
+          }
+          walk(typed_expr->body, state);
+        }
+        else if constexpr(std::same_as<T, expr::letfn>)
+        {
+          for(auto const &pair : typed_expr->pairs)
+          {
+            walk(pair.second, state);
+          }
+          walk(typed_expr->body, state);
+        }
+        else if constexpr(std::same_as<T, expr::do_>)
+        {
+          walk(typed_expr, state);
+        }
+        else if constexpr(std::same_as<T, expr::if_>)
+        {
+          walk(typed_expr->condition, state);
+          walk(typed_expr->then, state);
+          if(typed_expr->else_.is_some())
+          {
+            walk(typed_expr->else_.unwrap(), state);
+          }
+        }
+        else if constexpr(std::same_as<T, expr::throw_>)
+        {
+          walk(typed_expr->value, state);
+        }
+        else if constexpr(std::same_as<T, expr::try_>)
+        {
+          walk(typed_expr->body, state);
+          if(typed_expr->catch_body.is_some())
+          {
+            walk(typed_expr->catch_body.unwrap().body, state);
+          }
+          if(typed_expr->finally_body.is_some())
+          {
+            walk(typed_expr->finally_body.unwrap(), state);
+          }
+        }
+        else if constexpr(std::same_as<T, expr::case_>)
+        {
+          walk(typed_expr->value_expr, state);
+          walk(typed_expr->default_expr, state);
+          walk(typed_expr->exprs, state);
+        }
+        /* Everything else is a leaf which can't reference a local. */
+      },
+      expr);
+  }
+
+  /* Mutated in place. */
+  void mark_non_escaping(expr::let_ref const let)
+  {
+    for(usize i{}; i < let->pairs.size(); ++i)
+    {
+      auto const &pair(let->pairs[i]);
+      auto const fn(llvm::dyn_cast<expr::function>(pair.second.data));
+      if(!fn)
+      {
+        continue;
+      }
+
+      /* If the same name is bound again within this let, the frame only knows about one of
+       * them, so we don't try to reason about which is which. */
+      auto const rebound(std::ranges::count_if(let->pairs, [&](auto const &other) {
+                           return other.first->equal(*pair.first);
+                         })
+                         != 1);
+      auto const found(let->frame->locals.find(pair.first));
+      if(rebound || found == let->frame->locals.end())
+      {
+        continue;
+      }
+
+      escape_state state{ pair.first, &found->second };
+      for(usize j{ i + 1 }; j < let->pairs.size() && !state.escapes; ++j)
+      {
+        walk(let->pairs[j].second, state);
+      }
+      walk(let->body, state);
+
+      fn->escapes = state.escapes;
+    }
+  }
+}
@@ -0,0 +1,114 @@
+#include <cpptrace/from_current.hpp>
+
+#include <jank/analyze/step/fold.hpp>
+#include <jank/analyze/expr/var_deref.hpp>
+#include <jank/analyze/expr/local_reference.hpp>
+#include <jank/analyze/local_frame.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/util/try.hpp>
+
+namespace jank::analyze::step
+{
+  using namespace jank::runtime;
+
+  /* These are all free of side effects and will always give the same output for the same
+   * input, so it doesn't matter whether we call them now or at run time. */
+  static native_set<jtl::immutable_string> const pure_fns{
+    "+",        "-",       "*",       "/",        "inc",   "dec",    "quot",      "rem",
+    "mod",      "min",     "max",     "=",        "not=",  "==",     "<",         ">",
+    "<=",       ">=",      "not",     "zero?",    "pos?",  "neg?",   "even?",     "odd?",
+    "nil?",     "some?",   "str",     "keyword",  "symbol", "name",  "namespace", "subs",
+    "count",    "integer?", "string?", "keyword?", "symbol?", "number?"
+  };
+
+  /* We only fold into constants which codegen can emit directly. */
+  static bool is_foldable_constant(object_ref const o)
+  {
+    switch(o->type)
+    {
+      case object_type::nil:
+      case object_type::boolean:
+      case object_type::integer:
+      case object_type::real:
+      case object_type::ratio:
+      case object_type::persistent_string:
+      case object_type::keyword:
+      case object_type::symbol:
+      case object_type::character:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  static jtl::option<object_ref> constant_value(expression_ref const expr)
+  {
+    if(auto const literal{ llvm::dyn_cast<expr::primitive_literal>(expr.data) }; literal)
+    {
+      return literal->data;
+    }
+
+    /* Propagate constants through let bindings. Fn params and loop bindings have no
+     * value expression, so they're never treated as constant. A name which is bound more
+     * than once in the same let still resolves to its first binding, so we can't trust
+     * its value expression. */
+    if(auto const local{ llvm::dyn_cast<expr::local_reference>(expr.data) };
+       local && !local->binding->rebound)
+    {
+      auto const &value_expr(local->binding->value_expr);
+      if(value_expr.is_some())
+      {
+        if(auto const literal{ llvm::dyn_cast<expr::primitive_literal>(value_expr.unwrap().data) };
+           literal)
+        {
+          return literal->data;
+        }
+      }
+    }
+
+    return none;
+  }
+
+  jtl::option<expr::primitive_literal_ref> fold_call(expr::call_ref const call)
+  {
+    auto const var_deref(llvm::dyn_cast<expr::var_deref>(call->source_expr.data));
+    if(!var_deref || var_deref->var->dynamic.load()
+       || var_deref->var->n->name->name != "clojure.core"
+       || !pure_fns.contains(var_deref->var->name->name) || max_params < call->arg_exprs.size())
+    {
+      return none;
+    }
+
+    runtime::detail::native_transient_vector args;
+    for(auto const &arg_expr : call->arg_exprs)
+    {
+      auto const value(constant_value(arg_expr));
+      if(value.is_none())
+      {
+        return none;
+      }
+      args.push_back(value.unwrap());
+    }
+
+    /* If the call would throw, such as with a divide by zero, we leave it for run time, so
+     * the error happens when and where it's expected. */
+    object_ref result{};
+    JANK_TRY
+    {
+      result = apply_to(var_deref->var->deref(), make_box<obj::persistent_vector>(args.persistent()));
+    }
+    JANK_CATCH_THEN([](auto const &) {}, return none;)
+
+    if(!is_foldable_constant(result))
+    {
+      return none;
+    }
+
+    return jtl::make_ref<expr::primitive_literal>(call->position,
+                                                  call->frame,
+                                                  call->needs_box,
+                                                  result);
+  }
+}
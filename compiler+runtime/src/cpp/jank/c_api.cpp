@@ -364,31 +364,6 @@ extern "C"
       .erase();
   }
 
-  jank_object_ref jank_const_nil()
-  {
-    return jank_nil.erase();
-  }
-
-  jank_object_ref jank_const_true()
-  {
-    return jank_true.erase();
-  }
-
-  jank_object_ref jank_const_false()
-  {
-    return jank_false.erase();
-  }
-
-  jank_object_ref jank_integer_create(jank_i64 const i)
-  {
-    return make_box(i).erase();
-  }
-
-  jank_object_ref jank_real_create(jank_f64 const r)
-  {
-    return make_box(r).erase();
-  }
-
   jank_object_ref jank_ratio_create(jank_i64 const numerator, jank_i64 const denominator)
   {
     return make_box(runtime::obj::ratio_data(numerator, denominator)).erase();
@@ -656,6 +631,14 @@ extern "C"
 #pragma clang diagnostic pop
   }
 
+  /* The GC doesn't scan JIT compiled globals, so a direct call site's cached fn lives in an
+   * uncollectable cell instead, which the GC does scan. Registering each cache as its own
+   * root would run into the GC's limit on root sets, since modules are never unloaded. */
+  jank_object_ref *jank_direct_call_cache_create()
+  {
+    return static_cast<jank_object_ref *>(GC_MALLOC_UNCOLLECTABLE(sizeof(jank_object_ref)));
+  }
+
   jank_object_ref jank_closure_create(jank_arity_flags const arity_flags, void * const context)
   {
     return make_box<obj::jit_closure>(arity_flags, context).erase();
@@ -812,12 +795,6 @@ extern "C"
 #pragma clang diagnostic pop
   }
 
-  jank_bool jank_truthy(jank_object_ref const o)
-  {
-    auto const o_obj(reinterpret_cast<object *>(o));
-    return static_cast<jank_bool>(truthy(o_obj));
-  }
-
   jank_bool jank_equal(jank_object_ref const l, jank_object_ref const r)
   {
     auto const l_obj(reinterpret_cast<object *>(l));
@@ -917,18 +894,28 @@ extern "C"
     }
   }
 
-  void jank_profile_enter(char const * const label)
+  jank_u32 jank_profile_region(char const * const label)
+  {
+    return profile::intern_region(label);
+  }
+
+  void jank_profile_enter(jank_u32 const region)
   {
-    profile::enter(label);
+    profile::enter(region);
   }
 
-  void jank_profile_exit(char const * const label)
+  void jank_profile_exit(jank_u32 const region)
   {
-    profile::exit(label);
+    profile::exit(region);
   }
 
   void jank_profile_report(char const * const label)
   {
     profile::report(label);
   }
+
+  void jank_tier_up(char const * const body_name, void ** const tier)
+  {
+    __rt_ctx->jit_prc.tier_up(body_name, tier);
+  }
 }
@@ -0,0 +1,116 @@
+#include <jank/c_api.h>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/runtime/obj/nil.hpp>
+#include <jank/runtime/obj/number.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/runtime/var.hpp>
+
+/* These are the C API fns which are small and hot enough that we want the optimizer to
+ * be able to inline them into JIT compiled code. Aside from being part of jank itself,
+ * they're also compiled to LLVM bitcode, which codegen links into each module. So keep
+ * them small and keep their dependencies to headers, or to sources which are also listed
+ * in codegen/inline_bitcode.cpp. */
+
+using namespace jank;
+using namespace jank::runtime;
+
+extern "C"
+{
+  jank_object_ref jank_const_nil()
+  {
+    return jank_nil.erase();
+  }
+
+  jank_object_ref jank_const_true()
+  {
+    return jank_true.erase();
+  }
+
+  jank_object_ref jank_const_false()
+  {
+    return jank_false.erase();
+  }
+
+  jank_object_ref jank_integer_create(jank_i64 const i)
+  {
+    return make_box(i).erase();
+  }
+
+  jank_object_ref jank_real_create(jank_f64 const r)
+  {
+    return make_box(r).erase();
+  }
+
+  jank_object_ref jank_var_deref_root(jank_object_ref const var)
+  {
+    auto const var_obj(expect_object<runtime::var>(reinterpret_cast<object *>(var)));
+    /* A var can be made dynamic after the code dereferencing it was compiled, so we can't
+     * decide this at compile time. Until it's first thread bound, though, there's no
+     * binding to look for. */
+    if(var_obj->thread_bound.load(std::memory_order_relaxed))
+    {
+      return var_obj->deref().erase();
+    }
+    return var_obj->get_root().erase();
+  }
+
+  jank_bool jank_function_has_arity(jank_object_ref const fn, jank_u8 const arity, void * const f)
+  {
+    auto const fn_obj(reinterpret_cast<object *>(fn));
+    if(fn_obj->type != object_type::jit_function)
+    {
+      return false;
+    }
+
+    auto const typed_fn(expect_object<obj::jit_function>(fn_obj));
+    void *found{};
+    switch(arity)
+    {
+      case 0:
+        found = reinterpret_cast<void *>(typed_fn->arity_0);
+        break;
+      case 1:
+        found = reinterpret_cast<void *>(typed_fn->arity_1);
+        break;
+      case 2:
+        found = reinterpret_cast<void *>(typed_fn->arity_2);
+        break;
+      case 3:
+        found = reinterpret_cast<void *>(typed_fn->arity_3);
+        break;
+      case 4:
+        found = reinterpret_cast<void *>(typed_fn->arity_4);
+        break;
+      case 5:
+        found = reinterpret_cast<void *>(typed_fn->arity_5);
+        break;
+      case 6:
+        found = reinterpret_cast<void *>(typed_fn->arity_6);
+        break;
+      case 7:
+        found = reinterpret_cast<void *>(typed_fn->arity_7);
+        break;
+      case 8:
+        found = reinterpret_cast<void *>(typed_fn->arity_8);
+        break;
+      case 9:
+        found = reinterpret_cast<void *>(typed_fn->arity_9);
+        break;
+      case 10:
+        found = reinterpret_cast<void *>(typed_fn->arity_10);
+        break;
+      default:
+        return false;
+    }
+
+    return static_cast<jank_bool>(found && found == f);
+  }
+
+  jank_bool jank_truthy(jank_object_ref const o)
+  {
+    auto const o_obj(reinterpret_cast<object *>(o));
+    return static_cast<jank_bool>(truthy(o_obj));
+  }
+}
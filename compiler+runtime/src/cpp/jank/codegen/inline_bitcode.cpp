@@ -0,0 +1,6 @@
+/* This TU isn't part of jank itself. At build time, it's compiled to LLVM bitcode, which
+ * codegen links into each module, so that the optimizer can inline these fns into JIT
+ * compiled code. See c_api_inline.cpp. */
+
+#include "../c_api_inline.cpp"
+#include "../runtime/core/truthy.cpp"
@@ -1,4 +1,8 @@
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/InstIterator.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Transforms/Utils/Cloning.h>
 #include <llvm/Transforms/Utils/ModuleUtils.h>
 #include <llvm/TargetParser/Host.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
@@ -7,6 +11,7 @@
 #include <llvm/Transforms/Scalar/GVN.h>
 #include <llvm/Transforms/Scalar/Reassociate.h>
 #include <llvm/Transforms/Scalar/SimplifyCFG.h>
+#include <llvm/Transforms/Scalar/TailRecursionElimination.h>
 
 #include <jank/runtime/visit.hpp>
 #include <jank/codegen/llvm_processor.hpp>
@@ -18,13 +23,108 @@
 #include <jank/analyze/rtti.hpp>
 #include <jank/profile/time.hpp>
 #include <jank/util/fmt.hpp>
+#include <jank/util/process_location.hpp>
 
 /* TODO: Remove exceptions. */
 namespace jank::codegen
 {
   using namespace jank::analyze;
 
-  reusable_context::reusable_context(jtl::immutable_string const &module_name)
+  /* The inline bitcode is built alongside jank. See c_api_inline.cpp. If it can't be
+   * found, everything still works; we just call into jank for those fns. */
+  static std::unique_ptr<llvm::MemoryBuffer> load_inline_bitcode()
+  {
+    auto const jank_path(util::process_location().unwrap().parent_path());
+    for(auto const &path :
+        { jank_path / "jank-inline.bc", jank_path / "../share/jank-inline.bc" })
+    {
+      if(!std::filesystem::exists(path))
+      {
+        continue;
+      }
+      if(auto file{ llvm::MemoryBuffer::getFile(path.c_str()) }; file)
+      {
+        return std::move(file.get());
+      }
+    }
+    return nullptr;
+  }
+
+  llvm::MemoryBuffer const *inline_bitcode()
+  {
+    static std::unique_ptr<llvm::MemoryBuffer> const ret{ load_inline_bitcode() };
+    return ret.get();
+  }
+
+  /* Every fn in the inline bitcode with a strong definition is also part of jank, so it's
+   * linked in as available_externally. The optimizer can inline it, but it'll never be
+   * emitted. Globals are always left to jank, so that there's only one of each.
+   *
+   * Each module has its own LLVM context, so we can't share one parsed module between them.
+   * Instead, the bitcode is read lazily and only the fns this module already references, and
+   * whatever they use, are linked in. Only those fns are ever materialized. */
+  static void link_inline_bitcode(llvm::Module &m)
+  {
+    auto const bitcode(inline_bitcode());
+    if(!bitcode)
+    {
+      return;
+    }
+
+    auto parsed{ llvm::getLazyBitcodeModule(bitcode->getMemBufferRef(), m.getContext()) };
+    if(!parsed)
+    {
+      llvm::consumeError(parsed.takeError());
+      return;
+    }
+
+    auto &inline_module(**parsed);
+    inline_module.setTargetTriple(m.getTargetTriple());
+    inline_module.setDataLayout(m.getDataLayout());
+    for(auto &f : inline_module)
+    {
+      if(!f.isDeclaration() && f.hasExternalLinkage())
+      {
+        f.setLinkage(llvm::GlobalValue::AvailableExternallyLinkage);
+      }
+    }
+    for(auto &g : inline_module.globals())
+    {
+      if(!g.isDeclaration() && !g.hasLocalLinkage())
+      {
+        g.setInitializer(nullptr);
+        g.setComdat(nullptr);
+        g.setLinkage(llvm::GlobalValue::ExternalLinkage);
+      }
+    }
+
+    llvm::Linker::linkModules(m, std::move(*parsed), llvm::Linker::Flags::LinkOnlyNeeded);
+  }
+
+  static void inline_runtime_calls(llvm::Function &fn)
+  {
+    llvm::SmallVector<llvm::CallBase *> calls;
+    for(auto &inst : llvm::instructions(fn))
+    {
+      if(auto const call{ llvm::dyn_cast<llvm::CallBase>(&inst) }; call)
+      {
+        auto const callee(call->getCalledFunction());
+        if(callee && callee->hasAvailableExternallyLinkage())
+        {
+          calls.emplace_back(call);
+        }
+      }
+    }
+
+    for(auto const call : calls)
+    {
+      llvm::InlineFunctionInfo info;
+      llvm::InlineFunction(*call, info);
+    }
+  }
+
+  reusable_context::reusable_context(jtl::immutable_string const &module_name,
+                                     bool const tiered)
     : module_name{ module_name }
     , ctor_name{ runtime::munge(__rt_ctx->unique_string("jank_global_init")) }
     , llvm_ctx{ std::make_unique<llvm::LLVMContext>() }
@@ -40,6 +140,7 @@ namespace jank::codegen
     , pic{ std::make_unique<llvm::PassInstrumentationCallbacks>() }
     , si{ std::make_unique<llvm::StandardInstrumentations>(*llvm_ctx,
                                                            /*DebugLogging*/ true) }
+    , tiered{ tiered }
   {
     /* The LLVM front-end tips documentation suggests setting the target triple and
      * data layout to improve back-end codegen performance. */
@@ -53,14 +154,23 @@ namespace jank::codegen
 
     si->registerCallbacks(*pic, mam.get());
 
-    /* Do simple "peephole" optimizations and bit-twiddling optzns. */
-    fpm->addPass(llvm::InstCombinePass());
-    /* Reassociate expressions. */
-    fpm->addPass(llvm::ReassociatePass());
-    /* Eliminate Common SubExpressions. */
-    fpm->addPass(llvm::GVNPass());
+    /* Tiered code is compiled quickly first and then optimized properly once it's hot, so
+     * we skip the more expensive passes. */
+    if(!tiered)
+    {
+      /* Do simple "peephole" optimizations and bit-twiddling optzns. */
+      fpm->addPass(llvm::InstCombinePass());
+      /* Reassociate expressions. */
+      fpm->addPass(llvm::ReassociatePass());
+      /* Eliminate Common SubExpressions. */
+      fpm->addPass(llvm::GVNPass());
+    }
     /* Simplify the control flow graph (deleting unreachable blocks, etc). */
     fpm->addPass(llvm::SimplifyCFGPass());
+    /* Turn self-recursive tail calls, from recur, into loops. Loop bindings are still fn
+     * params, so they're boxed on each iteration; only math within an iteration stays
+     * unboxed. See analyze_loop. */
+    fpm->addPass(llvm::TailCallElimPass());
 
     llvm::PassBuilder pb;
     pb.registerModuleAnalyses(*mam);
@@ -73,7 +183,9 @@ namespace jank::codegen
                                  compilation_target const target)
     : target{ target }
     , root_fn{ expr }
-    , ctx{ std::make_unique<reusable_context>(module_name) }
+    , ctx{ std::make_unique<reusable_context>(
+        module_name,
+        target == compilation_target::eval && __rt_ctx->jit_prc.tier_up_threshold != 0) }
   {
   }
 
@@ -116,6 +228,18 @@ namespace jank::codegen
     fn = llvm::cast<llvm::Function>(fn_value.getCallee());
     fn->setLinkage(llvm::Function::ExternalLinkage);
 
+    if(ctx->tiered)
+    {
+      auto const body_name(util::format("{}_body", fn_name));
+      auto const body(llvm::Function::Create(fn_type,
+                                             llvm::Function::ExternalLinkage,
+                                             body_name.c_str(),
+                                             *ctx->module));
+      create_tier_entry(body, fn_name);
+      ctx->tiered_fns.emplace_back(body_name);
+      fn = body;
+    }
+
     auto const entry(llvm::BasicBlock::Create(*ctx->llvm_ctx, "entry", fn));
     ctx->builder->SetInsertPoint(entry);
 
@@ -182,7 +306,7 @@ namespace jank::codegen
 
   jtl::string_result<void> llvm_processor::gen()
   {
-    profile::timer const timer{ "ir gen" };
+    profile::timer const timer{ profile::region<"ir gen"> };
     if(target != compilation_target::function)
     {
       create_global_ctor();
@@ -202,6 +326,9 @@ namespace jank::codegen
       {
         ctx->builder->CreateRet(gen_global(jank_nil));
       }
+
+      /* The passes run once the whole module has been generated. See optimize. */
+      ctx->generated_fns.emplace_back(fn);
     }
 
     if(target == compilation_target::eval)
@@ -209,22 +336,18 @@ namespace jank::codegen
       //to_string();
     }
 
-    /* Run our optimization passes on the function, mutating it. */
-    ctx->fpm->run(*fn, *ctx->fam);
-
     if(target != compilation_target::function)
     {
       llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
       ctx->builder->SetInsertPoint(ctx->global_ctor_block);
 
-      if(profile::is_enabled())
+      if(ctx->profile_region)
       {
-        auto const fn_type(
-          llvm::FunctionType::get(ctx->builder->getVoidTy(), { ctx->builder->getPtrTy() }, false));
+        auto const fn_type(llvm::FunctionType::get(ctx->builder->getVoidTy(),
+                                                   { ctx->builder->getInt32Ty() },
+                                                   false));
         auto const fn(ctx->module->getOrInsertFunction("jank_profile_exit", fn_type));
-        ctx->builder->CreateCall(
-          fn,
-          { gen_c_string(util::format("global ctor for {}", root_fn->name)) });
+        ctx->builder->CreateCall(fn, { ctx->profile_region });
       }
 
       ctx->builder->CreateRetVoid();
@@ -233,6 +356,22 @@ namespace jank::codegen
     return ok();
   }
 
+  void llvm_processor::optimize()
+  {
+    profile::timer const timer{ profile::region<"ir optimize"> };
+
+    /* Now that we know every C API fn this module calls, we can link in just those
+     * from the inline bitcode. Then we run our optimization passes on each fn, mutating
+     * it. We inline the C API first, so the passes can see through those calls. */
+    link_inline_bitcode(*ctx->module);
+    for(auto const generated_fn : ctx->generated_fns)
+    {
+      inline_runtime_calls(*generated_fn);
+      ctx->fpm->run(*generated_fn, *ctx->fam);
+    }
+    ctx->generated_fns.clear();
+  }
+
   llvm::Value *llvm_processor::gen(expression_ref const ex, expr::function_arity const &fn_arity)
   {
     llvm::Value *ret{};
@@ -252,7 +391,8 @@ namespace jank::codegen
                                 false));
       auto const fn(ctx->module->getOrInsertFunction("jank_var_bind_root", fn_type));
 
-      llvm::SmallVector<llvm::Value *, 2> const args{ ref, gen(expr->value.unwrap(), arity) };
+      llvm::SmallVector<llvm::Value *, 2> const args{ ref,
+                                                      gen_box(gen(expr->value.unwrap(), arity)) };
       ctx->builder->CreateCall(fn, args);
     }
 
@@ -301,7 +441,10 @@ namespace jank::codegen
     auto const ref(gen_var(make_box<obj::symbol>(expr->var->n, expr->var->name)));
     auto const fn_type(
       llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getPtrTy() }, false));
-    auto const fn(ctx->module->getOrInsertFunction("jank_deref", fn_type));
+    /* This only looks for a thread binding once the var has been thread bound, which is
+     * checked at run time, since the var may be made dynamic after we compile this. It's
+     * inlined from the runtime bitcode. */
+    auto const fn(ctx->module->getOrInsertFunction("jank_var_deref_root", fn_type));
 
     llvm::SmallVector<llvm::Value *, 1> const args{ ref };
     auto const call(ctx->builder->CreateCall(fn, args));
@@ -340,29 +483,140 @@ namespace jank::codegen
     }
   }
 
-  llvm::Value *llvm_processor::gen(expr::call_ref const expr, expr::function_arity const &arity)
+  /* These are the math fns which we can lower to native instructions when all of their
+   * inputs are unboxed. Each of them has `:supports-unboxed-input?` arity meta, so the
+   * analyzer will already have left their args unboxed, where possible. */
+  enum class native_math_op : u8
+  {
+    add,
+    sub,
+    mul,
+    div,
+    lt,
+    lte,
+    gt,
+    gte,
+    min,
+    max,
+    inc,
+    dec,
+    sqrt,
+    abs,
+    pow
+  };
+
+  static jtl::option<native_math_op> find_native_math_op(expr::call_ref const expr)
   {
-    auto const callee(gen(expr->source_expr, arity));
+    auto const var_deref(llvm::dyn_cast<expr::var_deref>(expr->source_expr.data));
+    if(!var_deref)
+    {
+      return none;
+    }
+
+    static native_unordered_map<jtl::immutable_string, std::pair<native_math_op, usize>> const ops{
+      { "clojure.core/+", { native_math_op::add, 2 } },
+      { "clojure.core/-", { native_math_op::sub, 2 } },
+      { "clojure.core/*", { native_math_op::mul, 2 } },
+      { "clojure.core//", { native_math_op::div, 2 } },
+      { "clojure.core/<", { native_math_op::lt, 2 } },
+      { "clojure.core/<=", { native_math_op::lte, 2 } },
+      { "clojure.core/>", { native_math_op::gt, 2 } },
+      { "clojure.core/>=", { native_math_op::gte, 2 } },
+      { "clojure.core/min", { native_math_op::min, 2 } },
+      { "clojure.core/max", { native_math_op::max, 2 } },
+      { "clojure.core/inc", { native_math_op::inc, 1 } },
+      { "clojure.core/dec", { native_math_op::dec, 1 } },
+      { "jank.math/sqrt", { native_math_op::sqrt, 1 } },
+      { "jank.math/abs", { native_math_op::abs, 1 } },
+      { "jank.math/pow", { native_math_op::pow, 2 } },
+    };
 
+    auto const &var(var_deref->var);
+    auto const found(ops.find(util::format("{}/{}", var->n->name->name, var->name->name)));
+    if(found == ops.end() || found->second.second != expr->arg_exprs.size())
+    {
+      return none;
+    }
+    return found->second.first;
+  }
+
+  static bool is_unboxed_number(llvm::Value const * const v)
+  {
+    auto const type(v->getType());
+    return type->isIntegerTy(64) || type->isDoubleTy();
+  }
+
+  llvm::Value *llvm_processor::gen(expr::call_ref const expr, expr::function_arity const &arity)
+  {
     llvm::SmallVector<llvm::Value *> arg_handles;
     llvm::SmallVector<llvm::Type *> arg_types;
     arg_handles.reserve(expr->arg_exprs.size() + 1);
     arg_types.reserve(expr->arg_exprs.size() + 1);
 
-    arg_handles.emplace_back(callee);
-    arg_types.emplace_back(ctx->builder->getPtrTy());
+    /* For math calls, we generate the args first, since we may not need the callee at all
+     * if all of the args are unboxed. Var derefs have no side effects, so the order doesn't
+     * matter. For all other calls, the callee comes first. */
+    auto const native_op(find_native_math_op(expr));
+    if(native_op.is_some())
+    {
+      llvm::SmallVector<llvm::Value *> arg_values;
+      arg_values.reserve(expr->arg_exprs.size());
+      for(auto const &arg_expr : expr->arg_exprs)
+      {
+        arg_values.emplace_back(gen(arg_expr, arity));
+      }
+
+      if(auto ret{ gen_native_math(native_op.unwrap(), arg_values) }; ret)
+      {
+        if(expr->needs_box)
+        {
+          ret = gen_box(ret);
+        }
 
-    for(auto const &arg_expr : expr->arg_exprs)
+        if(expr->position == expression_position::tail)
+        {
+          return ctx->builder->CreateRet(gen_box(ret));
+        }
+
+        return ret;
+      }
+
+      arg_handles.emplace_back(gen(expr->source_expr, arity));
+      arg_types.emplace_back(ctx->builder->getPtrTy());
+      for(auto const arg_value : arg_values)
+      {
+        arg_handles.emplace_back(gen_box(arg_value));
+        arg_types.emplace_back(ctx->builder->getPtrTy());
+      }
+    }
+    else
     {
-      arg_handles.emplace_back(gen(arg_expr, arity));
+      arg_handles.emplace_back(gen(expr->source_expr, arity));
       arg_types.emplace_back(ctx->builder->getPtrTy());
+
+      for(auto const &arg_expr : expr->arg_exprs)
+      {
+        /* Fns with unboxed input meta may receive unboxed args, but we only ever
+         * pass boxed values through a dynamic call. */
+        arg_handles.emplace_back(gen_box(gen(arg_expr, arity)));
+        arg_types.emplace_back(ctx->builder->getPtrTy());
+      }
     }
 
     auto const call_fn_name(arity_to_call_fn(expr->arg_exprs.size()));
 
     auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
     auto const fn(ctx->module->getOrInsertFunction(call_fn_name.c_str(), fn_type));
-    auto const call(ctx->builder->CreateCall(fn, arg_handles));
+
+    llvm::Value *call{};
+    if(expr->direct_fn)
+    {
+      call = gen_direct_call(expr->direct_fn.as_ref(), fn, arg_handles);
+    }
+    else
+    {
+      call = ctx->builder->CreateCall(fn, arg_handles);
+    }
 
     if(expr->position == expression_position::tail)
     {
@@ -372,9 +626,236 @@ namespace jank::codegen
     return call;
   }
 
+  llvm::Value *llvm_processor::gen_native_math(native_math_op const op,
+                                               llvm::ArrayRef<llvm::Value *> const args) const
+  {
+    if(!std::ranges::all_of(args, is_unboxed_number))
+    {
+      return nullptr;
+    }
+
+    auto &builder(*ctx->builder);
+    auto const any_real(
+      std::ranges::any_of(args, [](auto const arg) { return arg->getType()->isDoubleTy(); }));
+    auto const to_real([&](llvm::Value * const v) -> llvm::Value * {
+      return v->getType()->isDoubleTy() ? v : builder.CreateSIToFP(v, builder.getDoubleTy());
+    });
+
+    /* Binary ops follow the same promotion rules as the boxed math fns: if either side
+     * is a real, both are treated as reals. */
+    llvm::Value *l{};
+    llvm::Value *r{};
+    if(args.size() == 2)
+    {
+      l = any_real ? to_real(args[0]) : args[0];
+      r = any_real ? to_real(args[1]) : args[1];
+    }
+
+    switch(op)
+    {
+      case native_math_op::add:
+        return any_real ? builder.CreateFAdd(l, r) : builder.CreateAdd(l, r);
+      case native_math_op::sub:
+        return any_real ? builder.CreateFSub(l, r) : builder.CreateSub(l, r);
+      case native_math_op::mul:
+        return any_real ? builder.CreateFMul(l, r) : builder.CreateMul(l, r);
+      case native_math_op::div:
+        /* Integer division needs to handle division by zero and ratios, so we leave
+         * that to the runtime. */
+        return any_real ? builder.CreateFDiv(l, r) : nullptr;
+      case native_math_op::lt:
+        return any_real ? builder.CreateFCmpOLT(l, r) : builder.CreateICmpSLT(l, r);
+      case native_math_op::lte:
+        return any_real ? builder.CreateFCmpOLE(l, r) : builder.CreateICmpSLE(l, r);
+      case native_math_op::gt:
+        return any_real ? builder.CreateFCmpOGT(l, r) : builder.CreateICmpSGT(l, r);
+      case native_math_op::gte:
+        return any_real ? builder.CreateFCmpOGE(l, r) : builder.CreateICmpSGE(l, r);
+      case native_math_op::min:
+        /* The boxed min/max return one of their inputs, without promotion, so we only
+         * lower them when both inputs have the same type. */
+        if(args[0]->getType() != args[1]->getType())
+        {
+          return nullptr;
+        }
+        return builder.CreateSelect(any_real ? builder.CreateFCmpOLT(l, r)
+                                             : builder.CreateICmpSLT(l, r),
+                                    l,
+                                    r);
+      case native_math_op::max:
+        if(args[0]->getType() != args[1]->getType())
+        {
+          return nullptr;
+        }
+        return builder.CreateSelect(any_real ? builder.CreateFCmpOGT(l, r)
+                                             : builder.CreateICmpSGT(l, r),
+                                    l,
+                                    r);
+      case native_math_op::inc:
+        return any_real
+          ? builder.CreateFAdd(args[0], llvm::ConstantFP::get(builder.getDoubleTy(), 1.0))
+          : builder.CreateAdd(args[0], builder.getInt64(1));
+      case native_math_op::dec:
+        return any_real
+          ? builder.CreateFSub(args[0], llvm::ConstantFP::get(builder.getDoubleTy(), 1.0))
+          : builder.CreateSub(args[0], builder.getInt64(1));
+      case native_math_op::sqrt:
+        return builder.CreateUnaryIntrinsic(llvm::Intrinsic::sqrt, to_real(args[0]));
+      case native_math_op::abs:
+        if(any_real)
+        {
+          return builder.CreateUnaryIntrinsic(llvm::Intrinsic::fabs, args[0]);
+        }
+        return builder.CreateBinaryIntrinsic(llvm::Intrinsic::abs, args[0], builder.getFalse());
+      case native_math_op::pow:
+        return builder.CreateBinaryIntrinsic(llvm::Intrinsic::pow,
+                                             to_real(args[0]),
+                                             to_real(args[1]));
+    }
+
+    return nullptr;
+  }
+
+  llvm::Value *llvm_processor::gen_box(llvm::Value * const v) const
+  {
+    auto const type(v->getType());
+    if(type->isIntegerTy(64))
+    {
+      auto const fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getInt64Ty() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_integer_create", fn_type));
+      return ctx->builder->CreateCall(fn, { v });
+    }
+    else if(type->isDoubleTy())
+    {
+      auto const fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getDoubleTy() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_real_create", fn_type));
+      return ctx->builder->CreateCall(fn, { v });
+    }
+    else if(type->isIntegerTy(1))
+    {
+      return ctx->builder->CreateSelect(v, gen_global(jank_true), gen_global(jank_false));
+    }
+
+    /* Already boxed, or not a value at all, such as a return. */
+    return v;
+  }
+
+  llvm::Value *llvm_processor::gen_direct_call(expr::function_ref const direct_fn,
+                                               llvm::FunctionCallee const dynamic_fn,
+                                               llvm::ArrayRef<llvm::Value *> const arg_handles)
+  {
+    /* The first handle is the callee; the rest are the args. */
+    auto const callee(arg_handles[0]);
+    auto const args(arg_handles.drop_front());
+    auto const target_fn_name(util::format("{}_{}", munge(direct_fn->unique_name), args.size()));
+
+    /* The target arity may live in a module we've previously JIT compiled, or it may be in
+     * the module we're currently building. If it's in neither, such as when its module
+     * failed to compile, we can't link against it, so we stick with the dynamic call. */
+    if(!ctx->module->getFunction(target_fn_name.c_str())
+       && __rt_ctx->jit_prc.find_symbol<void *>(target_fn_name).is_err())
+    {
+      return ctx->builder->CreateCall(dynamic_fn, arg_handles);
+    }
+
+    std::vector<llvm::Type *> const target_arg_types{ args.size(), ctx->builder->getPtrTy() };
+    auto const target_fn_type(
+      llvm::FunctionType::get(ctx->builder->getPtrTy(), target_arg_types, false));
+    auto const target_fn(ctx->module->getOrInsertFunction(target_fn_name.c_str(), target_fn_type));
+
+    /* Each target gets a cache of the last fn object we've verified to hold it. The fn
+     * object's arities never change, so if the var's current root is identical to the
+     * cached object, we can skip all checks and call the arity directly. If the var has
+     * been rebound, we check the new root once and then either cache it or take the
+     * dynamic path.
+     *
+     * The cache must be visible to the GC. Otherwise, the cached fn could be collected
+     * after its var is rebound and a new object could be allocated at the same address.
+     * The GC doesn't scan JIT compiled globals, so the global only points to a cell which
+     * the runtime allocates, once, when the module is loaded. */
+    auto const cache_name(util::format("{}_cache", target_fn_name));
+    llvm::Value *cache_global(ctx->module->getNamedGlobal(cache_name.c_str()));
+    if(!cache_global)
+    {
+      auto const var(create_global_var(cache_name));
+      ctx->module->insertGlobalVariable(var);
+      cache_global = var;
+
+      llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
+      ctx->builder->SetInsertPoint(ctx->global_ctor_block);
+      auto const create_fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), false));
+      auto const create_fn(
+        ctx->module->getOrInsertFunction("jank_direct_call_cache_create", create_fn_type));
+      ctx->builder->CreateStore(ctx->builder->CreateCall(create_fn), var);
+    }
+    auto const cache(ctx->builder->CreateLoad(ctx->builder->getPtrTy(), cache_global));
+
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const check_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "direct_check", current_fn));
+    auto const store_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "direct_store", current_fn));
+    auto const direct_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "direct_call", current_fn));
+    auto const dynamic_block(
+      llvm::BasicBlock::Create(*ctx->llvm_ctx, "dynamic_call", current_fn));
+    auto const merge_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "call_merge", current_fn));
+
+    auto const cached(ctx->builder->CreateLoad(ctx->builder->getPtrTy(), cache));
+    auto const is_cached(ctx->builder->CreateICmpEQ(callee, cached, "is_cached"));
+    ctx->builder->CreateCondBr(is_cached, direct_block, check_block);
+
+    ctx->builder->SetInsertPoint(check_block);
+    auto const has_arity_fn_type(llvm::FunctionType::get(
+      ctx->builder->getInt8Ty(),
+      { ctx->builder->getPtrTy(), ctx->builder->getInt8Ty(), ctx->builder->getPtrTy() },
+      false));
+    auto const has_arity_fn(
+      ctx->module->getOrInsertFunction("jank_function_has_arity", has_arity_fn_type));
+    auto const has_arity(ctx->builder->CreateCall(
+      has_arity_fn,
+      { callee, ctx->builder->getInt8(args.size()), target_fn.getCallee() }));
+    ctx->builder->CreateCondBr(
+      ctx->builder->CreateICmpEQ(has_arity, ctx->builder->getInt8(1), "has_arity"),
+      store_block,
+      dynamic_block);
+
+    ctx->builder->SetInsertPoint(store_block);
+    ctx->builder->CreateStore(callee, cache);
+    ctx->builder->CreateBr(direct_block);
+
+    ctx->builder->SetInsertPoint(direct_block);
+    auto const direct_call(ctx->builder->CreateCall(target_fn, args));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(dynamic_block);
+    auto const dynamic_call(ctx->builder->CreateCall(dynamic_fn, arg_handles));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(merge_block);
+    auto const phi(ctx->builder->CreatePHI(ctx->builder->getPtrTy(), 2, "call_tmp"));
+    phi->addIncoming(direct_call, direct_block);
+    phi->addIncoming(dynamic_call, dynamic_block);
+
+    return phi;
+  }
+
   llvm::Value *
   llvm_processor::gen(expr::primitive_literal_ref const expr, expr::function_arity const &)
   {
+    /* Numbers which don't need to be boxed are just native constants. */
+    if(!expr->needs_box && expr->position != expression_position::tail)
+    {
+      if(expr->data->type == object_type::integer)
+      {
+        return ctx->builder->getInt64(expect_object<obj::integer>(expr->data)->data);
+      }
+      else if(expr->data->type == object_type::real)
+      {
+        return llvm::ConstantFP::get(ctx->builder->getDoubleTy(),
+                                     expect_object<obj::real>(expr->data)->data);
+      }
+    }
+
     auto const ret(runtime::visit_object(
       [&](auto const typed_o) -> llvm::Value * {
         using T = typename decltype(typed_o)::value_type;
@@ -428,7 +909,7 @@ namespace jank::codegen
 
     for(auto const &expr : expr->data_exprs)
     {
-      args.emplace_back(gen(expr, arity));
+      args.emplace_back(gen_box(gen(expr, arity)));
     }
 
     auto const call(ctx->builder->CreateCall(fn, args));
@@ -454,7 +935,7 @@ namespace jank::codegen
 
     for(auto const &expr : expr->data_exprs)
     {
-      args.emplace_back(gen(expr, arity));
+      args.emplace_back(gen_box(gen(expr, arity)));
     }
 
     auto const call(ctx->builder->CreateCall(fn, args));
@@ -480,8 +961,8 @@ namespace jank::codegen
 
     for(auto const &pair : expr->data_exprs)
     {
-      args.emplace_back(gen(pair.first, arity));
-      args.emplace_back(gen(pair.second, arity));
+      args.emplace_back(gen_box(gen(pair.first, arity)));
+      args.emplace_back(gen_box(gen(pair.second, arity)));
     }
 
     auto const call(ctx->builder->CreateCall(fn, args));
@@ -507,7 +988,7 @@ namespace jank::codegen
 
     for(auto const &expr : expr->data_exprs)
     {
-      args.emplace_back(gen(expr, arity));
+      args.emplace_back(gen_box(gen(expr, arity)));
     }
 
     auto const call(ctx->builder->CreateCall(fn, args));
@@ -523,9 +1004,15 @@ namespace jank::codegen
   llvm::Value *
   llvm_processor::gen(expr::local_reference_ref const expr, expr::function_arity const &)
   {
-    auto const ret(locals[expr->binding->name]);
+    auto ret(locals[expr->binding->name]);
     jank_debug_assert(ret);
 
+    if(expr->needs_box || expr->position == expression_position::tail)
+    {
+      auto const found_boxed(boxed_locals.find(expr->binding->name));
+      ret = found_boxed == boxed_locals.end() ? gen_box(ret) : found_boxed->second;
+    }
+
     if(expr->position == expression_position::tail)
     {
       return ctx->builder->CreateRet(ret);
@@ -551,7 +1038,7 @@ namespace jank::codegen
       ctx = std::move(nested.ctx);
     }
 
-    auto const fn_obj(gen_function_instance(expr, fn_arity));
+    auto const fn_obj(gen_function_instance(expr, fn_arity, expr->escapes));
 
     if(expr->position == expression_position::tail)
     {
@@ -584,15 +1071,21 @@ namespace jank::codegen
 
     for(auto const &arg_expr : expr->arg_exprs)
     {
-      arg_handles.emplace_back(gen(arg_expr, arity));
+      arg_handles.emplace_back(gen_box(gen(arg_expr, arity)));
       arg_types.emplace_back(ctx->builder->getPtrTy());
     }
 
-    auto const call_fn_name(
-      util::format("{}_{}", munge(fn_expr.unique_name), expr->arg_exprs.size()));
+    /* For tiered fns, we recur straight into the body, not the entry, so that this remains
+     * self recursion which can be turned into a loop. */
+    auto const call_fn_name(util::format("{}_{}{}",
+                                         munge(fn_expr.unique_name),
+                                         expr->arg_exprs.size(),
+                                         ctx->tiered ? "_body" : ""));
     auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
     auto const fn(ctx->module->getOrInsertFunction(call_fn_name.c_str(), fn_type));
     auto const call(ctx->builder->CreateCall(fn, arg_handles));
+    /* recur is always in tail position, so we can hint this for tail call elimination. */
+    call->setTailCall();
 
     if(expr->position == expression_position::tail)
     {
@@ -613,7 +1106,7 @@ namespace jank::codegen
      * inside of a class which has a `this` which can just be used. They're standalone. So,
      * if you want an instance of that fn within the fn itself, we need to make one. For
      * closures, this will copy the current context to the new one. */
-    auto const &fn_obj(gen_function_instance(expr->fn_ctx->fn.as_ref(), arity));
+    auto const &fn_obj(gen_function_instance(expr->fn_ctx->fn.as_ref(), arity, true));
 
     if(expr->position == expression_position::tail)
     {
@@ -665,7 +1158,8 @@ namespace jank::codegen
 
     if(arity.fn_ctx->is_variadic)
     {
-      arg_handles.emplace_back(gen_function_instance(arity.fn_ctx->fn.as_ref(), arity));
+      arg_handles.emplace_back(
+        gen_function_instance(arity.fn_ctx->fn.as_ref(), arity, true));
       arg_types.emplace_back(ctx->builder->getPtrTy());
     }
     else if(is_closure)
@@ -681,11 +1175,8 @@ namespace jank::codegen
           get_or_insert_struct_type(util::format("{}_context", munge(fn.unique_name)),
                                     capture_types));
 
-        auto const malloc_fn_type(
-          llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getInt64Ty() }, false));
-        auto const malloc_fn(ctx->module->getOrInsertFunction("GC_malloc", malloc_fn_type));
-        auto const closure_obj(
-          ctx->builder->CreateCall(malloc_fn, { llvm::ConstantExpr::getSizeOf(closure_ctx_type) }));
+        /* This context is only read by the callee on entry, so it never outlives this call. */
+        auto const closure_obj(gen_closure_context(closure_ctx_type, false));
 
         usize index{};
         for(auto const &capture : captures)
@@ -711,7 +1202,7 @@ namespace jank::codegen
 
     for(auto const &arg_expr : expr->arg_exprs)
     {
-      arg_handles.emplace_back(gen(arg_expr, arity));
+      arg_handles.emplace_back(gen_box(gen(arg_expr, arity)));
       arg_types.emplace_back(ctx->builder->getPtrTy());
     }
 
@@ -743,6 +1234,7 @@ namespace jank::codegen
   llvm::Value *llvm_processor::gen(expr::let_ref const expr, expr::function_arity const &arity)
   {
     auto old_locals(locals);
+    auto old_boxed_locals(boxed_locals);
     for(auto const &pair : expr->pairs)
     {
       auto const local(expr->frame->find_local_or_capture(pair.first));
@@ -752,12 +1244,35 @@ namespace jank::codegen
                                                pair.first->to_string()) };
       }
 
-      locals[pair.first] = gen(pair.second, arity);
+      auto const value(gen(pair.second, arity));
+      locals[pair.first] = value;
       locals[pair.first]->setName(pair.first->to_string().c_str());
+
+      /* If this local is unboxed, but it's also used in a boxed context, we box it once
+       * here instead of at each usage. Literals already have a boxed global we can use. */
+      boxed_locals.erase(pair.first);
+      auto const &binding(local.unwrap().binding);
+      if(binding->has_boxed_usage && value->getType() != ctx->builder->getPtrTy())
+      {
+        auto const literal(llvm::dyn_cast<expr::primitive_literal>(pair.second.data));
+        if(literal && literal->data->type == object_type::integer)
+        {
+          boxed_locals[pair.first] = gen_global(expect_object<obj::integer>(literal->data));
+        }
+        else if(literal && literal->data->type == object_type::real)
+        {
+          boxed_locals[pair.first] = gen_global(expect_object<obj::real>(literal->data));
+        }
+        else
+        {
+          boxed_locals[pair.first] = gen_box(value);
+        }
+      }
     }
 
     auto const ret(gen(expr->body, arity));
     locals = std::move(old_locals);
+    boxed_locals = std::move(old_boxed_locals);
 
     /* XXX: No return creation, since we rely on the body to do that. */
 
@@ -787,6 +1302,7 @@ namespace jank::codegen
     deferred_inits = {};
 
     auto old_locals(locals);
+    auto old_boxed_locals(boxed_locals);
     for(auto const &pair : expr->pairs)
     {
       auto const local(expr->frame->find_local_or_capture(pair.first));
@@ -798,6 +1314,7 @@ namespace jank::codegen
 
       locals[pair.first] = gen(pair.second, arity);
       locals[pair.first]->setName(pair.first->to_string().c_str());
+      boxed_locals.erase(pair.first);
     }
 
     for(auto const &deferred_init : deferred_inits)
@@ -813,6 +1330,7 @@ namespace jank::codegen
 
     auto const ret(gen(expr->body, arity));
     locals = std::move(old_locals);
+    boxed_locals = std::move(old_boxed_locals);
     deferred_inits = std::move(old_deferred_inits);
 
     /* XXX: No return creation, since we rely on the body to do that. */
@@ -857,12 +1375,22 @@ namespace jank::codegen
      * to take care to not generate our own, too. */
     auto const is_return(expr->position == expression_position::tail);
     auto const condition(gen(expr->condition, arity));
-    auto const truthy_fn_type(
-      llvm::FunctionType::get(ctx->builder->getInt8Ty(), { ctx->builder->getPtrTy() }, false));
-    auto const fn(ctx->module->getOrInsertFunction("jank_truthy", truthy_fn_type));
-    llvm::SmallVector<llvm::Value *, 1> const args{ condition };
-    auto const call(ctx->builder->CreateCall(fn, args));
-    auto const cmp(ctx->builder->CreateICmpEQ(call, ctx->builder->getInt8(1), "iftmp"));
+    llvm::Value *cmp{};
+
+    /* Unboxed comparisons give us an i1 which we can branch on directly. */
+    if(condition->getType()->isIntegerTy(1))
+    {
+      cmp = condition;
+    }
+    else
+    {
+      auto const truthy_fn_type(
+        llvm::FunctionType::get(ctx->builder->getInt8Ty(), { ctx->builder->getPtrTy() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_truthy", truthy_fn_type));
+      llvm::SmallVector<llvm::Value *, 1> const args{ gen_box(condition) };
+      auto const call(ctx->builder->CreateCall(fn, args));
+      cmp = ctx->builder->CreateICmpEQ(call, ctx->builder->getInt8(1), "iftmp");
+    }
 
     auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
     auto then_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "then", current_fn));
@@ -926,7 +1454,7 @@ namespace jank::codegen
   llvm::Value *llvm_processor::gen(expr::throw_ref const expr, expr::function_arity const &arity)
   {
     /* TODO: Generate direct call to __cxa_throw. */
-    auto const value(gen(expr->value, arity));
+    auto const value(gen_box(gen(expr->value, arity)));
     auto const fn_type(
       llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getPtrTy() }, false));
     auto fn(ctx->module->getOrInsertFunction("jank_throw", fn_type));
@@ -979,7 +1507,7 @@ namespace jank::codegen
   {
     auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
     auto const position{ expr->position };
-    auto const value(gen(expr->value_expr, arity));
+    auto const value(gen_box(gen(expr->value_expr, arity)));
     auto const is_return{ position == expression_position::tail };
     auto const integer_fn_type(llvm::FunctionType::get(
       ctx->builder->getInt64Ty(),
@@ -1001,7 +1529,7 @@ namespace jank::codegen
                               : llvm::BasicBlock::Create(*ctx->llvm_ctx, "merge", current_fn) };
 
     ctx->builder->SetInsertPoint(default_block);
-    auto const default_val{ gen(expr->default_expr, arity) };
+    auto const default_val{ gen_box(gen(expr->default_expr, arity)) };
     if(!is_return)
     {
       ctx->builder->CreateBr(merge_block);
@@ -1019,7 +1547,7 @@ namespace jank::codegen
         block);
 
       ctx->builder->SetInsertPoint(block);
-      auto const case_val{ gen(expr->exprs[block_counter], arity) };
+      auto const case_val{ gen_box(gen(expr->exprs[block_counter], arity)) };
       case_values.push_back(case_val);
       if(!is_return)
       {
@@ -1496,8 +2024,29 @@ namespace jank::codegen
     return ctx->builder->CreateLoad(ctx->builder->getPtrTy(), global);
   }
 
+  llvm::Value *
+  llvm_processor::gen_closure_context(llvm::StructType * const type, bool const escapes) const
+  {
+    if(escapes)
+    {
+      auto const malloc_fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getInt64Ty() }, false));
+      auto const malloc_fn(ctx->module->getOrInsertFunction("GC_malloc", malloc_fn_type));
+      return ctx->builder->CreateCall(malloc_fn, { llvm::ConstantExpr::getSizeOf(type) });
+    }
+
+    /* Non-escaping contexts live in the current fn's frame. The alloca goes in the entry
+     * block so that it's allocated once, even if we're within a loop. The GC scans the stack
+     * conservatively, so the captures it holds are still kept alive. */
+    llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
+    auto &entry(ctx->builder->GetInsertBlock()->getParent()->getEntryBlock());
+    ctx->builder->SetInsertPoint(&entry, entry.getFirstInsertionPt());
+    return ctx->builder->CreateAlloca(type);
+  }
+
   llvm::Value *llvm_processor::gen_function_instance(expr::function_ref const expr,
-                                                     expr::function_arity const &fn_arity)
+                                                     expr::function_arity const &fn_arity,
+                                                     bool const escapes)
   {
     expr::function_arity const *variadic_arity{};
     expr::function_arity const *highest_fixed_arity{};
@@ -1553,11 +2102,7 @@ namespace jank::codegen
         get_or_insert_struct_type(util::format("{}_context", munge(expr->unique_name)),
                                   capture_types));
 
-      auto const malloc_fn_type(
-        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getInt64Ty() }, false));
-      auto const malloc_fn(ctx->module->getOrInsertFunction("GC_malloc", malloc_fn_type));
-      auto const closure_obj(
-        ctx->builder->CreateCall(malloc_fn, { llvm::ConstantExpr::getSizeOf(closure_ctx_type) }));
+      auto const closure_obj(gen_closure_context(closure_ctx_type, escapes));
 
       usize index{};
       for(auto const &capture : captures)
@@ -1650,14 +2195,107 @@ namespace jank::codegen
       llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
       ctx->builder->SetInsertPoint(ctx->global_ctor_block);
 
-      auto const fn_type(
-        llvm::FunctionType::get(ctx->builder->getVoidTy(), { ctx->builder->getPtrTy() }, false));
+      /* The label is interned once, when the module is loaded, so entering and exiting the
+       * region doesn't need to look it up. */
+      auto const region_fn_type(llvm::FunctionType::get(ctx->builder->getInt32Ty(),
+                                                        { ctx->builder->getPtrTy() },
+                                                        false));
+      auto const region_fn(ctx->module->getOrInsertFunction("jank_profile_region", region_fn_type));
+      ctx->profile_region = ctx->builder->CreateCall(
+        region_fn,
+        { gen_c_string(util::format("global ctor for {}", root_fn->name)) });
+
+      auto const fn_type(llvm::FunctionType::get(ctx->builder->getVoidTy(),
+                                                 { ctx->builder->getInt32Ty() },
+                                                 false));
       auto const fn(ctx->module->getOrInsertFunction("jank_profile_enter", fn_type));
-      ctx->builder->CreateCall(fn,
-                               { gen_c_string(util::format("global ctor for {}", root_fn->name)) });
+      ctx->builder->CreateCall(fn, { ctx->profile_region });
     }
   }
 
+  /* The tier entry looks like this:
+   *
+   * ```
+   * if(tier) { return tier(args...); }
+   * if(++count == threshold) { jank_tier_up(body_name, &tier); }
+   * return body(args...);
+   * ```
+   *
+   * The count is a relaxed load and store, rather than an atomic increment, so concurrent
+   * calls can lose counts. That's on purpose, since it only needs to be roughly right and
+   * we don't want to pay for a locked instruction on every call. The tier is stored by
+   * the background compiler, so it's loaded with acquire ordering. */
+  void llvm_processor::create_tier_entry(llvm::Function * const body,
+                                         jtl::immutable_string const &name) const
+  {
+    llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
+
+    auto const entry(ctx->module->getFunction(name.c_str()));
+    auto const ptr_type(ctx->builder->getPtrTy());
+    auto const i64_type(ctx->builder->getInt64Ty());
+    auto const tier_var(new llvm::GlobalVariable{ *ctx->module,
+                                                  ptr_type,
+                                                  false,
+                                                  llvm::GlobalVariable::ExternalLinkage,
+                                                  llvm::ConstantPointerNull::get(ptr_type),
+                                                  util::format("{}_tier", name).c_str() });
+    auto const count_var(new llvm::GlobalVariable{ *ctx->module,
+                                                   i64_type,
+                                                   false,
+                                                   llvm::GlobalVariable::InternalLinkage,
+                                                   llvm::ConstantInt::get(i64_type, 0),
+                                                   util::format("{}_count", name).c_str() });
+
+    llvm::SmallVector<llvm::Value *> args;
+    for(auto &arg : entry->args())
+    {
+      args.emplace_back(&arg);
+    }
+
+    auto const entry_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "entry", entry));
+    auto const tiered_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "tiered", entry));
+    auto const count_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "count", entry));
+    auto const tier_up_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "tier_up", entry));
+    auto const body_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "body", entry));
+
+    ctx->builder->SetInsertPoint(entry_block);
+    auto const tier(ctx->builder->CreateLoad(ptr_type, tier_var, "tier"));
+    tier->setAtomic(llvm::AtomicOrdering::Acquire);
+    tier->setAlignment(llvm::Align{ 8 });
+    ctx->builder->CreateCondBr(ctx->builder->CreateIsNull(tier), count_block, tiered_block);
+
+    ctx->builder->SetInsertPoint(tiered_block);
+    auto const tiered_call(ctx->builder->CreateCall(body->getFunctionType(), tier, args));
+    tiered_call->setTailCall();
+    ctx->builder->CreateRet(tiered_call);
+
+    ctx->builder->SetInsertPoint(count_block);
+    auto const prev_count(ctx->builder->CreateLoad(i64_type, count_var, "prev_count"));
+    prev_count->setAtomic(llvm::AtomicOrdering::Monotonic);
+    prev_count->setAlignment(llvm::Align{ 8 });
+    auto const count(
+      ctx->builder->CreateAdd(prev_count, llvm::ConstantInt::get(i64_type, 1), "count"));
+    auto const store_count(ctx->builder->CreateStore(count, count_var));
+    store_count->setAtomic(llvm::AtomicOrdering::Monotonic);
+    store_count->setAlignment(llvm::Align{ 8 });
+    auto const is_hot(ctx->builder->CreateICmpEQ(
+      count,
+      llvm::ConstantInt::get(i64_type, __rt_ctx->jit_prc.tier_up_threshold)));
+    ctx->builder->CreateCondBr(is_hot, tier_up_block, body_block);
+
+    ctx->builder->SetInsertPoint(tier_up_block);
+    auto const tier_up_fn_type(
+      llvm::FunctionType::get(ctx->builder->getVoidTy(), { ptr_type, ptr_type }, false));
+    auto const tier_up_fn(ctx->module->getOrInsertFunction("jank_tier_up", tier_up_fn_type));
+    ctx->builder->CreateCall(tier_up_fn, { gen_c_string(body->getName().str()), tier_var });
+    ctx->builder->CreateBr(body_block);
+
+    ctx->builder->SetInsertPoint(body_block);
+    auto const body_call(ctx->builder->CreateCall(body, args));
+    body_call->setTailCall();
+    ctx->builder->CreateRet(body_call);
+  }
+
   llvm::GlobalVariable *llvm_processor::create_global_var(jtl::immutable_string const &name) const
   {
     return new llvm::GlobalVariable{ ctx->builder->getPtrTy(),
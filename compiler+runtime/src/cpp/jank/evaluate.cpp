@@ -1,4 +1,5 @@
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/ns.hpp>
@@ -6,6 +7,9 @@
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/meta.hpp>
 #include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/obj/jit_closure.hpp>
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/c_api.h>
 #include <jank/codegen/llvm_processor.hpp>
 #include <jank/jit/processor.hpp>
 #include <jank/evaluate.hpp>
@@ -13,6 +17,7 @@
 #include <jank/util/scope_exit.hpp>
 #include <jank/util/fmt/print.hpp>
 #include <jank/analyze/visit.hpp>
+#include <jank/analyze/rtti.hpp>
 
 namespace jank::evaluate
 {
@@ -246,15 +251,444 @@ namespace jank::evaluate
       expr);
   }
 
+  /* The interpreter tier walks the analyzed expression tree directly, which is far cheaper
+   * than generating, optimizing, and JIT compiling an IR module for every evaluated form.
+   * Interpreted fns are jit_closures whose context is an interpreted_fn and whose arities
+   * are the trampolines below, so the rest of the runtime can't tell the difference.
+   *
+   * Once an interpreted fn without captures has been called often enough, it's JIT compiled
+   * and all further calls go to the compiled fn. */
+  struct interpreted_fn : gc
+  {
+    object_ref call(native_vector<object_ref> &&args);
+    jtl::ptr<obj::jit_function> promote();
+
+    expr::function_ref expr;
+    /* The ns the fn was evaluated in, which is where its module goes once it's compiled. */
+    ns_ref fn_ns;
+    obj::jit_closure_ref closure;
+    native_unordered_map<obj::symbol_ref, object_ref> captures;
+    /* Any fns which lexically enclose this one, so that named recursion can find them. */
+    native_unordered_map<expr::function const *, object_ref> enclosing_fns;
+    std::atomic<u32> call_count{};
+    std::atomic_bool promoted{};
+    std::atomic<obj::jit_function *> compiled{};
+  };
+
+  struct interpret_frame
+  {
+    jtl::ptr<interpreted_fn> fn;
+    native_unordered_map<obj::symbol_ref, object_ref> locals;
+    native_vector<object_ref> recur_args;
+    bool recurring{};
+  };
+
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static thread_local interpret_frame *current_frame{};
+
+  /* Top-level forms have no frame, so binding forms make one for their duration. */
+  struct frame_scope
+  {
+    frame_scope()
+      : prev{ current_frame }
+    {
+      if(!current_frame)
+      {
+        current_frame = &root;
+      }
+    }
+
+    ~frame_scope()
+    {
+      current_frame = prev;
+    }
+
+    interpret_frame &frame() const
+    {
+      return *current_frame;
+    }
+
+    interpret_frame root;
+    interpret_frame *prev{};
+  };
+
+  /* Binds locals within the current frame and restores any shadowed values once the
+   * binding form is done. */
+  struct local_scope
+  {
+    local_scope(interpret_frame &frame)
+      : frame{ frame }
+    {
+    }
+
+    ~local_scope()
+    {
+      for(auto it(shadowed.rbegin()); it != shadowed.rend(); ++it)
+      {
+        if(it->second.is_some())
+        {
+          frame.locals[it->first] = it->second.unwrap();
+        }
+        else
+        {
+          frame.locals.erase(it->first);
+        }
+      }
+    }
+
+    void bind(obj::symbol_ref const sym, object_ref const value)
+    {
+      auto const found(frame.locals.find(sym));
+      if(found == frame.locals.end())
+      {
+        shadowed.emplace_back(sym, none);
+        frame.locals.emplace(sym, value);
+      }
+      else
+      {
+        shadowed.emplace_back(sym, found->second);
+        found->second = value;
+      }
+    }
+
+    interpret_frame &frame;
+    native_vector<std::pair<obj::symbol_ref, jtl::option<object_ref>>> shadowed;
+  };
+
+  static bool interpreting()
+  {
+    return __rt_ctx->interpreter_enabled;
+  }
+
+  static object_ref find_local(interpret_frame const &frame, obj::symbol_ref const sym)
+  {
+    auto const found(frame.locals.find(sym));
+    if(found != frame.locals.end())
+    {
+      return found->second;
+    }
+
+    if(frame.fn)
+    {
+      auto const found_capture(frame.fn->captures.find(sym));
+      if(found_capture != frame.fn->captures.end())
+      {
+        return found_capture->second;
+      }
+    }
+
+    throw std::runtime_error{ util::format("ICE: unable to find local: {}", sym->to_string()) };
+  }
+
+  static object_ref find_fn(interpret_frame const &frame, expr::function const * const fn)
+  {
+    if(frame.fn)
+    {
+      if(frame.fn->expr.data == fn)
+      {
+        return frame.fn->closure;
+      }
+
+      auto const found(frame.fn->enclosing_fns.find(fn));
+      if(found != frame.fn->enclosing_fns.end())
+      {
+        return found->second;
+      }
+    }
+
+    throw std::runtime_error{ util::format("ICE: unable to find fn: {}", fn->name) };
+  }
+
+  static object_ref apply_args(object_ref const source, native_vector<object_ref> const &arg_vals)
+  {
+    switch(arg_vals.size())
+    {
+      case 0:
+        return dynamic_call(source);
+      case 1:
+        return dynamic_call(source, arg_vals[0]);
+      case 2:
+        return dynamic_call(source, arg_vals[0], arg_vals[1]);
+      case 3:
+        return dynamic_call(source, arg_vals[0], arg_vals[1], arg_vals[2]);
+      case 4:
+        return dynamic_call(source, arg_vals[0], arg_vals[1], arg_vals[2], arg_vals[3]);
+      case 5:
+        return dynamic_call(source, arg_vals[0], arg_vals[1], arg_vals[2], arg_vals[3], arg_vals[4]);
+      case 6:
+        return dynamic_call(source,
+                            arg_vals[0],
+                            arg_vals[1],
+                            arg_vals[2],
+                            arg_vals[3],
+                            arg_vals[4],
+                            arg_vals[5]);
+      case 7:
+        return dynamic_call(source,
+                            arg_vals[0],
+                            arg_vals[1],
+                            arg_vals[2],
+                            arg_vals[3],
+                            arg_vals[4],
+                            arg_vals[5],
+                            arg_vals[6]);
+      case 8:
+        return dynamic_call(source,
+                            arg_vals[0],
+                            arg_vals[1],
+                            arg_vals[2],
+                            arg_vals[3],
+                            arg_vals[4],
+                            arg_vals[5],
+                            arg_vals[6],
+                            arg_vals[7]);
+      case 9:
+        return dynamic_call(source,
+                            arg_vals[0],
+                            arg_vals[1],
+                            arg_vals[2],
+                            arg_vals[3],
+                            arg_vals[4],
+                            arg_vals[5],
+                            arg_vals[6],
+                            arg_vals[7],
+                            arg_vals[8]);
+      case 10:
+        return dynamic_call(source,
+                            arg_vals[0],
+                            arg_vals[1],
+                            arg_vals[2],
+                            arg_vals[3],
+                            arg_vals[4],
+                            arg_vals[5],
+                            arg_vals[6],
+                            arg_vals[7],
+                            arg_vals[8],
+                            arg_vals[9]);
+      default:
+        {
+          return dynamic_call(source,
+                              arg_vals[0],
+                              arg_vals[1],
+                              arg_vals[2],
+                              arg_vals[3],
+                              arg_vals[4],
+                              arg_vals[5],
+                              arg_vals[6],
+                              arg_vals[7],
+                              arg_vals[8],
+                              arg_vals[9],
+                              try_object<obj::persistent_list>(arg_vals[10]));
+        }
+    }
+  }
+
+  object_ref interpreted_fn::call(native_vector<object_ref> &&args)
+  {
+    auto const found_arity(std::ranges::find_if(expr->arities, [&](auto const &arity) {
+      return arity.params.size() == args.size();
+    }));
+    jank_debug_assert(found_arity != expr->arities.end());
+    auto const &arity(*found_arity);
+
+    interpret_frame frame{ this, {}, {}, false };
+    auto const prev_frame(current_frame);
+    current_frame = &frame;
+    util::scope_exit const finally{ [=]() { current_frame = prev_frame; } };
+
+    /* recur re-binds the params and goes around again, rather than growing the native stack. */
+    while(true)
+    {
+      for(usize i{}; i < args.size(); ++i)
+      {
+        frame.locals[arity.params[i]] = args[i];
+      }
+
+      auto const ret(eval(arity.body));
+      if(!frame.recurring)
+      {
+        return ret;
+      }
+
+      frame.recurring = false;
+      args = std::move(frame.recur_args);
+      frame.recur_args = {};
+    }
+  }
+
+  static object_ref jit_eval(expr::function_ref const expr, jtl::immutable_string const &ns_name);
+
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<usize> promoted_fns{};
+
+  usize promoted_fn_count()
+  {
+    return promoted_fns.load();
+  }
+
+  jtl::ptr<obj::jit_function> interpreted_fn::promote()
+  {
+    if(auto const ret{ compiled.load() }; ret)
+    {
+      return ret;
+    }
+
+    /* Fns which can never be promoted, or which already failed to be, don't count their
+     * calls, so they don't pay for an atomic increment on each one. */
+    auto const threshold(__rt_ctx->interpreter_jit_threshold);
+    if(threshold == 0 || !captures.empty() || !enclosing_fns.empty() || promoted.load()
+       || ++call_count < threshold || promoted.exchange(true))
+    {
+      return nullptr;
+    }
+
+    /* If we can't compile it, for whatever reason, we can keep interpreting it. That includes
+     * jank errors and thrown jank objects, not just C++ exceptions. */
+    try
+    {
+      auto const fn(expect_object<obj::jit_function>(jit_eval(expr, fn_ns->to_string())));
+      compiled.store(fn.data);
+      ++promoted_fns;
+      return fn.data;
+    }
+    catch(...)
+    {
+      return nullptr;
+    }
+  }
+
+  template <typename... Args>
+  static object *interpret_arity(void * const context, Args * const... args)
+  {
+    auto &fn(*static_cast<interpreted_fn *>(context));
+    if(auto const compiled{ fn.promote() }; compiled)
+    {
+      return compiled->call(object_ref{ args }...).data;
+    }
+    return fn.call({ object_ref{ args }... }).data;
+  }
+
+  template <usize>
+  using arity_arg = object;
+
+  template <usize... Is>
+  static auto interpret_arity_ptr(std::index_sequence<Is...>)
+  {
+    return &interpret_arity<arity_arg<Is>...>;
+  }
+
+  static interpreted_fn &make_interpreted_fn(expr::function_ref const expr)
+  {
+    expr::function_arity const *variadic_arity{};
+    expr::function_arity const *highest_fixed_arity{};
+    for(auto const &arity : expr->arities)
+    {
+      if(arity.fn_ctx->is_variadic)
+      {
+        variadic_arity = &arity;
+      }
+      else if(!highest_fixed_arity
+              || highest_fixed_arity->fn_ctx->param_count < arity.fn_ctx->param_count)
+      {
+        highest_fixed_arity = &arity;
+      }
+    }
+    auto const variadic_ambiguous(highest_fixed_arity && variadic_arity
+                                  && highest_fixed_arity->fn_ctx->param_count
+                                    == variadic_arity->fn_ctx->param_count - 1);
+    auto const highest_fixed_args(variadic_arity ? variadic_arity->fn_ctx->param_count - 1
+                                                 : highest_fixed_arity->fn_ctx->param_count);
+
+    auto const fn(new(GC) interpreted_fn{});
+    fn->expr = expr;
+    fn->fn_ns = __rt_ctx->current_ns();
+    fn->closure = make_box<obj::jit_closure>(
+      behavior::callable::build_arity_flags(highest_fixed_args, variadic_arity, variadic_ambiguous),
+      fn);
+    fn->closure->meta = strip_source_from_meta(expr->meta);
+
+    for(auto const &arity : expr->arities)
+    {
+      switch(arity.params.size())
+      {
+        case 0:
+          fn->closure->arity_0 = interpret_arity_ptr(std::make_index_sequence<0>{});
+          break;
+        case 1:
+          fn->closure->arity_1 = interpret_arity_ptr(std::make_index_sequence<1>{});
+          break;
+        case 2:
+          fn->closure->arity_2 = interpret_arity_ptr(std::make_index_sequence<2>{});
+          break;
+        case 3:
+          fn->closure->arity_3 = interpret_arity_ptr(std::make_index_sequence<3>{});
+          break;
+        case 4:
+          fn->closure->arity_4 = interpret_arity_ptr(std::make_index_sequence<4>{});
+          break;
+        case 5:
+          fn->closure->arity_5 = interpret_arity_ptr(std::make_index_sequence<5>{});
+          break;
+        case 6:
+          fn->closure->arity_6 = interpret_arity_ptr(std::make_index_sequence<6>{});
+          break;
+        case 7:
+          fn->closure->arity_7 = interpret_arity_ptr(std::make_index_sequence<7>{});
+          break;
+        case 8:
+          fn->closure->arity_8 = interpret_arity_ptr(std::make_index_sequence<8>{});
+          break;
+        case 9:
+          fn->closure->arity_9 = interpret_arity_ptr(std::make_index_sequence<9>{});
+          break;
+        case 10:
+          fn->closure->arity_10 = interpret_arity_ptr(std::make_index_sequence<10>{});
+          break;
+        default:
+          throw std::runtime_error{ util::format("Unsupported arity for interpreted fn: {}",
+                                                 arity.params.size()) };
+      }
+    }
+
+    if(current_frame)
+    {
+      for(auto const &capture : expr->captures())
+      {
+        /* Captures of letfn siblings may not be bound yet. Those are filled in by letfn. */
+        auto const found(current_frame->locals.find(capture.first));
+        if(found != current_frame->locals.end())
+        {
+          fn->captures[capture.first] = found->second;
+        }
+        else if(current_frame->fn)
+        {
+          auto const found_capture(current_frame->fn->captures.find(capture.first));
+          if(found_capture != current_frame->fn->captures.end())
+          {
+            fn->captures[capture.first] = found_capture->second;
+          }
+        }
+      }
+
+      if(current_frame->fn)
+      {
+        fn->enclosing_fns = current_frame->fn->enclosing_fns;
+        fn->enclosing_fns[current_frame->fn->expr.data] = current_frame->fn->closure;
+      }
+    }
+
+    return *fn;
+  }
+
   object_ref eval(expression_ref const ex)
   {
-    profile::timer const timer{ "eval ast node" };
+    profile::timer const timer{ profile::region<"eval ast node"> };
     object_ref ret{};
     visit_expr([&ret](auto const typed_ex) { ret = eval(typed_ex); }, ex);
     return ret;
   }
 
-  object_ref eval(expr::def_ref const expr)
+  var_ref intern_def(expr::def_ref const expr)
   {
     auto var(__rt_ctx->intern_var(expr->name).expect_ok());
     var->meta = expr->name->meta;
@@ -263,6 +697,25 @@ namespace jank::evaluate
     auto const dynamic(get(meta, __rt_ctx->intern_keyword("dynamic").expect_ok()));
     var->set_dynamic(truthy(dynamic));
 
+    return var;
+  }
+
+  object_ref eval_batch(native_vector<expression_ref> const &exprs, processor const &an_prc)
+  {
+    profile::timer const timer{ [&] {
+      return util::format("eval batch of {}", exprs.size());
+    } };
+    if(exprs.size() == 1)
+    {
+      return eval(exprs[0]);
+    }
+    return dynamic_call(eval(wrap_expressions(exprs, an_prc, "batch")));
+  }
+
+  object_ref eval(expr::def_ref const expr)
+  {
+    auto const var(intern_def(expr));
+
     if(expr->value.is_none())
     {
       return var;
@@ -309,94 +762,11 @@ namespace jank::evaluate
               arg_vals.emplace_back(eval(arg_expr));
             }
 
-            switch(arg_vals.size())
-            {
-              case 0:
-                return dynamic_call(source);
-              case 1:
-                return dynamic_call(source, arg_vals[0]);
-              case 2:
-                return dynamic_call(source, arg_vals[0], arg_vals[1]);
-              case 3:
-                return dynamic_call(source, arg_vals[0], arg_vals[1], arg_vals[2]);
-              case 4:
-                return dynamic_call(source, arg_vals[0], arg_vals[1], arg_vals[2], arg_vals[3]);
-              case 5:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4]);
-              case 6:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4],
-                                    arg_vals[5]);
-              case 7:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4],
-                                    arg_vals[5],
-                                    arg_vals[6]);
-              case 8:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4],
-                                    arg_vals[5],
-                                    arg_vals[6],
-                                    arg_vals[7]);
-              case 9:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4],
-                                    arg_vals[5],
-                                    arg_vals[6],
-                                    arg_vals[7],
-                                    arg_vals[8]);
-              case 10:
-                return dynamic_call(source,
-                                    arg_vals[0],
-                                    arg_vals[1],
-                                    arg_vals[2],
-                                    arg_vals[3],
-                                    arg_vals[4],
-                                    arg_vals[5],
-                                    arg_vals[6],
-                                    arg_vals[7],
-                                    arg_vals[8],
-                                    arg_vals[9]);
-              default:
-                {
-                  return dynamic_call(source,
-                                      arg_vals[0],
-                                      arg_vals[1],
-                                      arg_vals[2],
-                                      arg_vals[3],
-                                      arg_vals[4],
-                                      arg_vals[5],
-                                      arg_vals[6],
-                                      arg_vals[7],
-                                      arg_vals[8],
-                                      arg_vals[9],
-                                      try_object<obj::persistent_list>(arg_vals[10]));
-                }
-            }
+            return apply_args(source, arg_vals);
           }
           else if constexpr(std::same_as<T, obj::persistent_hash_set>
-                            || std::same_as<T, obj::transient_vector>)
+                            || std::same_as<T, obj::transient_vector>
+                            || std::same_as<T, obj::promise>)
           {
             auto const s(expr->arg_exprs.size());
             if(s != 1)
@@ -445,11 +815,7 @@ namespace jank::evaluate
 
   object_ref eval(expr::primitive_literal_ref const expr)
   {
-    if(expr->data->type == object_type::keyword)
-    {
-      auto const d(expect_object<obj::keyword>(expr->data));
-      return __rt_ctx->intern_keyword(d->sym->ns, d->sym->name).expect_ok();
-    }
+    /* Keyword literals were already interned by the reader, so they can be returned as is. */
     return expr->data;
   }
 
@@ -552,51 +918,118 @@ namespace jank::evaluate
     }
   }
 
-  object_ref eval(expr::local_reference_ref const)
-  /* Doesn't make sense to eval these, since let is wrapped in a fn and JIT compiled. */
+  object_ref eval(expr::local_reference_ref const expr)
   {
-    throw make_box("unsupported eval: local_reference");
+    /* Without the interpreter, this doesn't make sense to eval, since let is wrapped in a
+     * fn and JIT compiled. */
+    if(!interpreting() || !current_frame)
+    {
+      throw make_box("unsupported eval: local_reference");
+    }
+    return find_local(*current_frame, expr->name);
   }
 
   object_ref eval(expr::function_ref const expr)
   {
-    auto const &module(
-      module::nest_module(expect_object<ns>(__rt_ctx->current_ns_var->deref())->to_string(),
-                          munge(expr->unique_name)));
+    if(interpreting())
+    {
+      return make_interpreted_fn(expr).closure;
+    }
+    return jit_eval(expr, __rt_ctx->current_ns()->to_string());
+  }
+
+  static object_ref jit_eval(expr::function_ref const expr, jtl::immutable_string const &ns_name)
+  {
+    auto const &module(module::nest_module(ns_name, munge(expr->unique_name)));
 
     auto const wrapped_expr(evaluate::wrap_expression(expr, "repl_fn", {}));
     codegen::llvm_processor cg_prc{ wrapped_expr, module, codegen::compilation_target::eval };
     cg_prc.gen().expect_ok();
 
     {
-      profile::timer const timer{ util::format("ir jit compile {}", expr->name) };
-      __rt_ctx->jit_prc.load_ir_module(std::move(cg_prc.ctx->module),
-                                       std::move(cg_prc.ctx->llvm_ctx));
+      profile::timer const timer{ [&] {
+        return util::format("ir jit compile {}", expr->name);
+      } };
+      /* The object cache is keyed by the IR before it's optimized, so a hit skips both
+       * optimizing and compiling it. */
+      auto &jit_prc(__rt_ctx->jit_prc);
+      auto const cache_path(jit_prc.object_cache_path(*cg_prc.ctx->module));
+      auto cached_object(jit_prc.find_cached_object(cache_path));
+      if(!cached_object)
+      {
+        cg_prc.optimize();
+      }
+      if(cached_object)
+      {
+        jit_prc.load_cached_object(std::move(cached_object),
+                                   std::move(cg_prc.ctx->module),
+                                   std::move(cg_prc.ctx->llvm_ctx),
+                                   cg_prc.ctx->tiered_fns);
+      }
+      else
+      {
+        jit_prc.load_ir_module(std::move(cg_prc.ctx->module),
+                               std::move(cg_prc.ctx->llvm_ctx),
+                               cache_path,
+                               cg_prc.ctx->tiered_fns);
+      }
 
       auto const fn(
-        __rt_ctx->jit_prc
+        jit_prc
           .find_symbol<object *(*)()>(util::format("{}_0", munge(cg_prc.root_fn->unique_name)))
           .expect_ok());
       return fn();
     }
   }
 
-  object_ref eval(expr::recur_ref const)
-  /* This will always be in a fn or loop, which will be JIT compiled. */
+  object_ref eval(expr::recur_ref const expr)
   {
-    throw make_box("unsupported eval: recur");
+    /* Without the interpreter, this will always be in a fn or loop, which will be
+     * JIT compiled. */
+    if(!interpreting() || !current_frame || !current_frame->fn)
+    {
+      throw make_box("unsupported eval: recur");
+    }
+
+    /* recur is always in tail position, so we just stash the new args and unwind back to
+     * the interpreted fn, which will go around again. */
+    native_vector<object_ref> args;
+    args.reserve(expr->arg_exprs.size());
+    for(auto const &arg_expr : expr->arg_exprs)
+    {
+      args.emplace_back(eval(arg_expr));
+    }
+    current_frame->recur_args = std::move(args);
+    current_frame->recurring = true;
+    return jank_nil;
   }
 
-  object_ref eval(expr::recursion_reference_ref const)
-  /* This will always be in a fn, which will be JIT compiled. */
+  object_ref eval(expr::recursion_reference_ref const expr)
   {
-    throw make_box("unsupported eval: recursion_reference");
+    /* Without the interpreter, this will always be in a fn, which will be JIT compiled. */
+    if(!interpreting() || !current_frame)
+    {
+      throw make_box("unsupported eval: recursion_reference");
+    }
+    return find_fn(*current_frame, expr->fn_ctx->fn.data);
   }
 
-  object_ref eval(expr::named_recursion_ref const)
-  /* This will always be in a fn, which will be JIT compiled. */
+  object_ref eval(expr::named_recursion_ref const expr)
   {
-    throw make_box("unsupported eval: named_recursion");
+    /* Without the interpreter, this will always be in a fn, which will be JIT compiled. */
+    if(!interpreting() || !current_frame)
+    {
+      throw make_box("unsupported eval: named_recursion");
+    }
+
+    auto const source(find_fn(*current_frame, expr->recursion_ref.fn_ctx->fn.data));
+    native_vector<object_ref> arg_vals;
+    arg_vals.reserve(expr->arg_exprs.size());
+    for(auto const &arg_expr : expr->arg_exprs)
+    {
+      arg_vals.emplace_back(eval(arg_expr));
+    }
+    return apply_args(source, arg_vals);
   }
 
   object_ref eval(expr::do_ref const expr)
@@ -611,12 +1044,56 @@ namespace jank::evaluate
 
   object_ref eval(expr::let_ref const expr)
   {
-    return dynamic_call(eval(wrap_expression(expr, "let", {})));
+    if(!interpreting())
+    {
+      return dynamic_call(eval(wrap_expression(expr, "let", {})));
+    }
+
+    frame_scope const frame;
+    local_scope locals{ frame.frame() };
+    for(auto const &pair : expr->pairs)
+    {
+      locals.bind(pair.first, eval(pair.second));
+    }
+    return eval(expr->body);
   }
 
   object_ref eval(expr::letfn_ref const expr)
   {
-    return dynamic_call(eval(wrap_expression(expr, "letfn", {})));
+    if(!interpreting())
+    {
+      return dynamic_call(eval(wrap_expression(expr, "letfn", {})));
+    }
+
+    frame_scope const frame;
+    local_scope locals{ frame.frame() };
+    native_vector<jtl::ptr<interpreted_fn>> fns;
+    for(auto const &pair : expr->pairs)
+    {
+      auto const fn_expr(llvm::dyn_cast<expr::function>(pair.second.data));
+      if(fn_expr)
+      {
+        auto &fn(make_interpreted_fn(fn_expr));
+        fns.emplace_back(&fn);
+        locals.bind(pair.first, fn.closure);
+      }
+      else
+      {
+        locals.bind(pair.first, eval(pair.second));
+      }
+    }
+
+    /* Bindings can refer to each other, regardless of order, so we can only fill in the
+     * captures once everything is bound. */
+    for(auto const &fn : fns)
+    {
+      for(auto const &capture : fn->expr->captures())
+      {
+        fn->captures[capture.first] = find_local(frame.frame(), capture.first);
+      }
+    }
+
+    return eval(expr->body);
   }
 
   object_ref eval(expr::if_ref const expr)
@@ -661,6 +1138,14 @@ namespace jank::evaluate
     }
     catch(object_ref const e)
     {
+      if(interpreting())
+      {
+        frame_scope const frame;
+        local_scope locals{ frame.frame() };
+        locals.bind(expr->catch_body.unwrap().sym, e);
+        return eval(expr->catch_body.unwrap().body);
+      }
+
       return dynamic_call(eval(wrap_expression(expr->catch_body.unwrap().body,
                                                "catch",
                                                { expr->catch_body.unwrap().sym })),
@@ -670,6 +1155,20 @@ namespace jank::evaluate
 
   object_ref eval(expr::case_ref const expr)
   {
-    return dynamic_call(eval(wrap_expression(expr, "case", {})));
+    if(!interpreting())
+    {
+      return dynamic_call(eval(wrap_expression(expr, "case", {})));
+    }
+
+    auto const value(eval(expr->value_expr));
+    auto const key(jank_shift_mask_case_integer(value.data, expr->shift, expr->mask));
+    for(usize i{}; i < expr->keys.size(); ++i)
+    {
+      if(expr->keys[i] == key)
+      {
+        return eval(expr->exprs[i]);
+      }
+    }
+    return eval(expr->default_expr);
   }
 }
@@ -1,5 +1,8 @@
+#include <array>
+
 #include <jank/hash.hpp>
 #include <jank/runtime/visit.hpp>
+#include <jank/runtime/obj/keyword.hpp>
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/sequence_range.hpp>
 
@@ -126,12 +129,33 @@ namespace jank::hash
     }
   }
 
+  /* How many pairs of chars are mixed at once. */
+  static constexpr usize string_block_size{ 8 };
+
   u32 string(native_persistent_string_view const &input)
   {
     auto const length(input.size());
     u32 h1{ seed };
 
-    for(usize i{ 1 }; i < length; i += 2)
+    /* Each pair of chars is mixed into a k1 of its own, and only folding that into h1 depends
+     * on the pairs before it. So we mix a block of pairs first, which the compiler can
+     * vectorize, then fold them in order. The result is the same as one pair at a time. */
+    usize i{ 1 };
+    for(; i + 2 * (string_block_size - 1) < length; i += 2 * string_block_size)
+    {
+      std::array<u32, string_block_size> k1s{};
+      for(usize j{}; j != string_block_size; ++j)
+      {
+        auto const pair(i + 2 * j);
+        k1s[j] = mix_k1(static_cast<u32>(input[pair - 1] | (input[pair] << 16)));
+      }
+      for(auto const k1 : k1s)
+      {
+        h1 = mix_h1(h1, k1);
+      }
+    }
+
+    for(; i < length; i += 2)
     {
       auto k1(static_cast<u32>(input[i - 1] | (input[i] << 16)));
       k1 = mix_k1(k1);
@@ -155,6 +179,12 @@ namespace jank::hash
 
   u32 visit(runtime::object_ref const o)
   {
+    /* Keywords are the most common map keys by far and their hash is stored right in them,
+     * so we skip dispatching for them. */
+    if(o->type == runtime::object_type::keyword)
+    {
+      return runtime::expect_object<runtime::obj::keyword>(o)->hash;
+    }
     return runtime::visit_object([](auto const typed_o) -> u32 { return typed_o->to_hash(); }, o);
   }
 
@@ -165,6 +195,63 @@ namespace jank::hash
     return o->to_hash();
   }
 
+  /* 31 * 0xbdef7bdf wraps around to 1, so multiplying by this undoes multiplying by 31. */
+  static constexpr u32 inverse_31{ 0xbdef7bdf };
+  static_assert(static_cast<u32>(31 * inverse_31) == 1);
+
+  u32 ordered_push(u32 const sum, u32 const item_hash)
+  {
+    return 31 * sum + item_hash;
+  }
+
+  u32 ordered_pop(u32 const sum, u32 const item_hash)
+  {
+    return (sum - item_hash) * inverse_31;
+  }
+
+  u32 unordered_entry(runtime::object_ref const o)
+  {
+    return visit(o);
+  }
+
+  u32 unordered_entry(runtime::object_ref const key, runtime::object_ref const val)
+  {
+    return 31 * visit(key) + visit(val);
+  }
+
+  bool is_cached(runtime::object_ref const o)
+  {
+    using namespace runtime;
+
+    switch(o->type)
+    {
+      case object_type::nil:
+      case object_type::boolean:
+      case object_type::integer:
+      case object_type::real:
+      case object_type::ratio:
+      case object_type::persistent_string:
+      case object_type::keyword:
+      case object_type::symbol:
+      case object_type::character:
+        return true;
+      case object_type::persistent_vector:
+        return expect_object<obj::persistent_vector>(o)->items_hash != 0;
+      case object_type::persistent_array_map:
+        return expect_object<obj::persistent_array_map>(o)->entries_hash != 0;
+      case object_type::persistent_hash_map:
+        return expect_object<obj::persistent_hash_map>(o)->entries_hash != 0;
+      case object_type::persistent_sorted_map:
+        return expect_object<obj::persistent_sorted_map>(o)->entries_hash != 0;
+      case object_type::persistent_hash_set:
+        return expect_object<obj::persistent_hash_set>(o)->items_hash != 0;
+      case object_type::persistent_sorted_set:
+        return expect_object<obj::persistent_sorted_set>(o)->items_hash != 0;
+      default:
+        return false;
+    }
+  }
+
   u32 ordered(runtime::object const * const sequence)
   {
     jank_debug_assert(sequence);
@@ -1,15 +1,39 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#include <unistd.h>
 
 #include <clang/AST/Type.h>
 #include <clang/Basic/Diagnostic.h>
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Frontend/FrontendDiagnostic.h>
 #include <llvm/ExecutionEngine/Orc/Core.h>
+#include <llvm/ExecutionEngine/Orc/CompileOnDemandLayer.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/IndirectionUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/ExecutionEngine/Orc/LazyReexports.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/TargetParser/Host.h>
 
 #include <cpptrace/gdb_jit.hpp>
 
@@ -17,7 +41,11 @@
 #include <jank/util/make_array.hpp>
 #include <jank/util/dir.hpp>
 #include <jank/util/fmt.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/util/sha256.hpp>
+#include <jank/util/try.hpp>
 #include <jank/jit/processor.hpp>
+#include <jank/codegen/llvm_processor.hpp>
 #include <jank/profile/time.hpp>
 
 namespace jank::jit
@@ -70,10 +98,475 @@ namespace jank::jit
     }
   }
 
+  /* Lazily compiled fns may be first called from any thread, but the interpreter's JIT
+   * compiles on the calling thread with a compiler which isn't thread-safe. This layer sits
+   * between the compile on demand layer and the JIT's own layers to serialize that, using
+   * the same lock as every other path into the JIT. */
+  struct serialized_ir_layer : llvm::orc::IRLayer
+  {
+    serialized_ir_layer(llvm::orc::ExecutionSession &es,
+                        llvm::orc::IRLayer &base,
+                        std::recursive_mutex &mutex)
+      : llvm::orc::IRLayer{ es, base.getManglingOptions() }
+      , base{ base }
+      , mutex{ mutex }
+    {
+    }
+
+    void emit(std::unique_ptr<llvm::orc::MaterializationResponsibility> r,
+              llvm::orc::ThreadSafeModule tsm) override
+    {
+      std::lock_guard<std::recursive_mutex> const lock{ mutex };
+      profile::timer const timer{ profile::region<"jit lazy compile"> };
+      base.emit(std::move(r), std::move(tsm));
+      register_jit_stack_frames();
+    }
+
+    llvm::orc::IRLayer &base;
+    std::recursive_mutex &mutex;
+  };
+
+  /* Global ctors are only run for IR modules, so any module we're not handing straight to
+   * the JIT needs its ctors pulled out, to be run by us once it's loaded. */
+  static native_vector<jtl::immutable_string> take_global_ctors(llvm::Module &m)
+  {
+    native_vector<jtl::immutable_string> ctors;
+    for(auto const &ctor : llvm::orc::getConstructors(m))
+    {
+      if(ctor.Func)
+      {
+        ctors.emplace_back(static_cast<std::string_view>(ctor.Func->getName()));
+      }
+    }
+    if(auto const global_ctors{ m.getGlobalVariable("llvm.global_ctors") }; global_ctors)
+    {
+      global_ctors->eraseFromParent();
+    }
+    return ctors;
+  }
+
+  /* The ctors aren't run while holding the JIT lock, since they may need to lazily
+   * compile fns on other threads. */
+  static void run_global_ctors(llvm::orc::LLJIT &ee,
+                               std::recursive_mutex &mutex,
+                               native_vector<jtl::immutable_string> const &ctors)
+  {
+    for(auto const &ctor : ctors)
+    {
+      void (*ctor_fn)(){};
+      {
+        std::lock_guard<std::recursive_mutex> const lock{ mutex };
+        ctor_fn = llvm::cantFail(ee.lookup(ctor.c_str())).toPtr<void (*)()>();
+      }
+      ctor_fn();
+    }
+  }
+
+  static jtl::string_result<void>
+  compile_object(llvm::Module &m, i64 const optimization_level, llvm::SmallVectorImpl<char> &out)
+  {
+    auto tm_builder{ llvm::orc::JITTargetMachineBuilder::detectHost() };
+    if(!tm_builder)
+    {
+      return err(llvm::toString(tm_builder.takeError()));
+    }
+
+    /* Cached objects are loaded wherever the JIT's linker puts them, just like the objects
+     * we write when compiling modules. */
+    tm_builder->setRelocationModel(llvm::Reloc::PIC_);
+
+    switch(optimization_level)
+    {
+      case 0:
+        tm_builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::None);
+        break;
+      case 1:
+        tm_builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::Less);
+        break;
+      case 2:
+        tm_builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::Default);
+        break;
+      default:
+        tm_builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::Aggressive);
+        break;
+    }
+
+    auto const target_machine{ tm_builder->createTargetMachine() };
+    if(!target_machine)
+    {
+      return err(llvm::toString(target_machine.takeError()));
+    }
+
+    llvm::raw_svector_ostream os{ out };
+    llvm::legacy::PassManager pass;
+    if((*target_machine)
+         ->addPassesToEmitFile(pass, os, nullptr, llvm::CodeGenFileType::ObjectFile))
+    {
+      return err("unable to emit object files for this target");
+    }
+    pass.run(m);
+
+    return ok();
+  }
+
+  /* Once the object cache grows past this, the least recently used objects are evicted. */
+  static constexpr std::uintmax_t max_object_cache_bytes{ 512 * 1024 * 1024 };
+  /* We evict once at startup and then again each time we've written this much, so a store
+   * doesn't need to look at the whole cache. */
+  static constexpr std::uintmax_t object_cache_evict_interval_bytes{ max_object_cache_bytes / 8 };
+
+  static void evict_cached_objects(jtl::immutable_string const &cache_dir)
+  {
+    profile::timer const timer{ profile::region<"jit cache evict"> };
+
+    struct entry
+    {
+      std::filesystem::file_time_type last_used;
+      std::filesystem::path path;
+      std::uintmax_t size{};
+    };
+
+    std::error_code error{};
+    native_vector<entry> entries;
+    std::uintmax_t total{};
+    auto const now(std::filesystem::file_time_type::clock::now());
+    for(auto const &file : std::filesystem::directory_iterator{ cache_dir.c_str(), error })
+    {
+      auto const size(file.file_size(error));
+      auto const last_used(file.last_write_time(error));
+      if(error)
+      {
+        error.clear();
+        continue;
+      }
+
+      /* Temporary files are other writers' objects which are still in flight, so they're
+       * left alone, unless they're so old that their writer must have died. */
+      if(file.path().extension() == ".tmp")
+      {
+        if(now - last_used > std::chrono::hours{ 24 })
+        {
+          std::filesystem::remove(file.path(), error);
+        }
+        continue;
+      }
+
+      total += size;
+      entries.push_back({ last_used, file.path(), size });
+    }
+    if(total <= max_object_cache_bytes)
+    {
+      return;
+    }
+
+    std::ranges::sort(entries, {}, &entry::last_used);
+    for(auto const &e : entries)
+    {
+      if(total <= max_object_cache_bytes)
+      {
+        break;
+      }
+      /* Other processes may be evicting too, so it may already be gone. */
+      std::filesystem::remove(e.path, error);
+      total -= e.size;
+    }
+  }
+
+  static bool store_cached_object(jtl::immutable_string const &cache_dir,
+                                  jtl::immutable_string const &path,
+                                  llvm::SmallVectorImpl<char> const &object)
+  {
+    /* Other processes may be caching the same module, so we write to a file of our own
+     * and then move it into place, which is atomic. */
+    std::error_code file_error{};
+    std::filesystem::create_directories(cache_dir.c_str(), file_error);
+    auto const tmp_path(util::format("{}.{}.{}.tmp",
+                                     path,
+                                     getpid(),
+                                     std::hash<std::thread::id>{}(std::this_thread::get_id())));
+    {
+      llvm::raw_fd_ostream os{ tmp_path.c_str(), file_error, llvm::sys::fs::OF_None };
+      if(!file_error)
+      {
+        os.write(object.data(), object.size());
+      }
+    }
+    if(file_error || llvm::sys::fs::rename(tmp_path.c_str(), path.c_str()))
+    {
+      llvm::sys::fs::remove(tmp_path.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /* Objects depend on more than their IR. The inline bitcode is only linked in after we've
+   * looked in the cache, and the object calls into this exact build of jank, whose version
+   * may not change between rebuilds. So we key on both of those too. */
+  static jtl::immutable_string object_cache_build_id()
+  {
+    jtl::immutable_string bitcode_hash;
+    if(auto const bitcode{ codegen::inline_bitcode() }; bitcode)
+    {
+      bitcode_hash = util::sha256(
+        native_persistent_string_view{ bitcode->getBufferStart(), bitcode->getBufferSize() });
+    }
+
+    std::uintmax_t jank_size{};
+    std::filesystem::file_time_type jank_modified{};
+    if(auto const jank_path{ util::process_location() }; jank_path.is_some())
+    {
+      std::error_code error{};
+      jank_size = std::filesystem::file_size(jank_path.unwrap(), error);
+      jank_modified = std::filesystem::last_write_time(jank_path.unwrap(), error);
+    }
+
+    return util::format("{}.{}.{}.{}",
+                        static_cast<std::string_view>(llvm::sys::getHostCPUName()),
+                        bitcode_hash,
+                        jank_size,
+                        jank_modified.time_since_epoch().count());
+  }
+
+  /* Recompiling a body only needs the body itself. Everything else it uses has already
+   * been loaded, from the first tier, so we turn it all into declarations. Constants are
+   * the exception, since they're local to each module, as is the inline bitcode, which is
+   * never emitted anyway. */
+  static void keep_only_bodies(llvm::Module &m, std::unordered_set<std::string> const &bodies)
+  {
+    if(auto const global_ctors{ m.getGlobalVariable("llvm.global_ctors") }; global_ctors)
+    {
+      global_ctors->eraseFromParent();
+    }
+    for(auto &f : m)
+    {
+      if(!f.isDeclaration() && !f.hasAvailableExternallyLinkage()
+         && !bodies.contains(f.getName().str()))
+      {
+        f.deleteBody();
+        f.setDSOLocal(false);
+      }
+    }
+    for(auto &g : m.globals())
+    {
+      if(!g.isDeclaration() && !(g.isConstant() && g.hasLocalLinkage()))
+      {
+        g.setInitializer(nullptr);
+        g.setLinkage(llvm::GlobalValue::ExternalLinkage);
+        g.setDSOLocal(false);
+      }
+    }
+  }
+
+  /* The tiered bodies of a module, and the declarations they need, as bitcode. This is all
+   * we keep around to tier up from, so it's both much smaller than the module and free of
+   * its LLVM context. It's shared by each of the module's tiered fns and freed once every
+   * one of them has been queued. */
+  struct tiered_module
+  {
+    tiered_module(std::string &&bitcode, std::atomic<usize> &pending_bytes)
+      : bitcode{ std::move(bitcode) }
+      , pending_bytes{ pending_bytes }
+    {
+      pending_bytes += this->bitcode.size();
+    }
+
+    ~tiered_module()
+    {
+      pending_bytes -= bitcode.size();
+    }
+
+    std::string bitcode;
+    std::atomic<usize> &pending_bytes;
+  };
+
+  /* Hot fns are recompiled on a single background thread, so tiering up never blocks the
+   * fn which got hot. */
+  struct tier_compiler
+  {
+    struct request
+    {
+      std::string body_name;
+      void **tier{};
+      std::shared_ptr<tiered_module> module;
+    };
+
+    tier_compiler(llvm::orc::LLJIT &ee, std::recursive_mutex &jit_mutex)
+      : ee{ ee }
+      , jit_mutex{ jit_mutex }
+    {
+      GC_allow_register_threads();
+      worker = std::thread{ [this] { run(); } };
+    }
+
+    ~tier_compiler()
+    {
+      {
+        std::lock_guard<std::mutex> const lock{ mutex };
+        stopping = true;
+      }
+      cv.notify_one();
+      worker.join();
+    }
+
+    void run()
+    {
+      /* Error strings are GC allocated, so the GC needs to know about this thread. */
+      GC_stack_base stack_base{};
+      GC_get_stack_base(&stack_base);
+      GC_register_my_thread(&stack_base);
+      util::scope_exit const unregister{ [] { GC_unregister_my_thread(); } };
+
+      while(true)
+      {
+        request req;
+        {
+          std::unique_lock<std::mutex> lock{ mutex };
+          cv.wait(lock, [this] { return stopping || !queue.empty(); });
+          if(stopping)
+          {
+            return;
+          }
+          req = std::move(queue.front());
+          queue.pop_front();
+        }
+
+        /* If we can't tier up, for whatever reason, the fn just keeps its first tier. */
+        if(auto error{ compile(req) }; error)
+        {
+          llvm::consumeError(std::move(error));
+        }
+      }
+    }
+
+    llvm::Error compile(request &req)
+    {
+      llvm::LLVMContext llvm_ctx;
+      auto parsed{ llvm::parseBitcodeFile(
+        llvm::MemoryBufferRef{ req.module->bitcode, req.body_name },
+        llvm_ctx) };
+      req.module.reset();
+      if(!parsed)
+      {
+        return parsed.takeError();
+      }
+      auto &m(**parsed);
+      auto const body(m.getFunction(req.body_name));
+      if(!body)
+      {
+        return llvm::createStringError(llvm::inconvertibleErrorCode(),
+                                       "missing tiered fn body");
+      }
+
+      /* The module's other tiered bodies are in here too, but they get their own request. */
+      keep_only_bodies(m, { req.body_name });
+      auto const tier_name(req.body_name + "_tier1");
+      body->setName(tier_name);
+
+      auto tm_builder{ llvm::orc::JITTargetMachineBuilder::detectHost() };
+      if(!tm_builder)
+      {
+        return tm_builder.takeError();
+      }
+      tm_builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::Aggressive);
+      auto target_machine{ tm_builder->createTargetMachine() };
+      if(!target_machine)
+      {
+        return target_machine.takeError();
+      }
+
+      {
+        llvm::LoopAnalysisManager lam;
+        llvm::FunctionAnalysisManager fam;
+        llvm::CGSCCAnalysisManager cgam;
+        llvm::ModuleAnalysisManager mam;
+        llvm::PassBuilder pb{ target_machine->get() };
+        pb.registerModuleAnalyses(mam);
+        pb.registerCGSCCAnalyses(cgam);
+        pb.registerFunctionAnalyses(fam);
+        pb.registerLoopAnalyses(lam);
+        pb.crossRegisterProxies(lam, fam, cgam, mam);
+        pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3).run(m, mam);
+      }
+
+      llvm::SmallVector<char, 0> object;
+      if(auto const res{ compile_object(m, 3, object) }; res.is_err())
+      {
+        return llvm::createStringError(llvm::inconvertibleErrorCode(),
+                                       "%s",
+                                       res.expect_err().c_str());
+      }
+
+      /* Everything up to here was done in our own LLVM context, but now we're going into
+       * the JIT, which is shared with the other threads. */
+      std::lock_guard<std::recursive_mutex> const lock{ jit_mutex };
+      if(auto error{ ee.addObjectFile(llvm::MemoryBuffer::getMemBufferCopy(
+           llvm::StringRef{ object.data(), object.size() },
+           tier_name)) })
+      {
+        return error;
+      }
+      auto const address{ ee.lookup(tier_name) };
+      if(!address)
+      {
+        return address.takeError();
+      }
+
+      std::atomic_ref<void *>{ *req.tier }.store(address->toPtr<void *>(),
+                                                 std::memory_order_release);
+      ++completed;
+      return llvm::Error::success();
+    }
+
+    llvm::orc::LLJIT &ee;
+    std::recursive_mutex &jit_mutex;
+    std::mutex mutex;
+    std::condition_variable cv;
+    /* The size of every tiered module we're holding onto. This must outlive them. */
+    std::atomic<usize> pending_bytes{};
+    /* Tiered fn body names to their module. A body is removed once it's been queued, so
+     * it's only ever tiered up once. */
+    std::unordered_map<std::string, std::shared_ptr<tiered_module>> modules;
+    std::deque<request> queue;
+    std::atomic<usize> completed{};
+    bool stopping{};
+    std::thread worker;
+  };
+
+  /* When a lazy compile fails, the call-through's lookup of the fn reports a
+   * FailedToMaterialize error and then calls this in place of the fn. Both happen on the
+   * calling thread, so we hold onto that error until then and throw it from here, as though
+   * the fn itself had thrown. Every other error the session reports, such as the compile
+   * error behind that failure, or one from materializing on some other thread, has nobody
+   * waiting on it, so it's printed right away. */
+  static thread_local std::string lazy_compile_error;
+
+  static void report_jit_error(llvm::Error error)
+  {
+    /* A failure which was never thrown still needs to be seen. */
+    if(!lazy_compile_error.empty())
+    {
+      util::print_exception(
+        util::format("JIT error: {}", std::exchange(lazy_compile_error, {})));
+    }
+
+    llvm::handleAllErrors(
+      std::move(error),
+      [](llvm::orc::FailedToMaterialize const &e) { lazy_compile_error = e.message(); },
+      [](llvm::ErrorInfoBase const &e) {
+        util::print_exception(util::format("JIT error: {}", e.message()));
+      });
+  }
+
+  static void handle_lazy_compile_failure()
+  {
+    throw std::runtime_error{ util::format("unable to lazily JIT compile fn: {}",
+                                           std::exchange(lazy_compile_error, {})) };
+  }
+
   processor::processor(util::cli::options const &opts)
     : optimization_level{ opts.optimization_level }
   {
-    profile::timer const timer{ "jit ctor" };
+    profile::timer const timer{ profile::region<"jit ctor"> };
 
     for(auto const &library_dir : opts.library_dirs)
     {
@@ -139,6 +632,42 @@ namespace jank::jit
 
     interpreter = llvm::cantFail(clang::Interpreter::create(std::move(compiler_instance)));
 
+    if(opts.lazy_jit)
+    {
+      auto &ee(interpreter->getExecutionEngine().get());
+      auto &es(ee.getExecutionSession());
+      es.setErrorReporter(&report_jit_error);
+      lazy_call_through = llvm::cantFail(llvm::orc::createLocalLazyCallThroughManager(
+        ee.getTargetTriple(),
+        es,
+        llvm::orc::ExecutorAddr::fromPtr(&handle_lazy_compile_failure)));
+      serialized_layer
+        = std::make_unique<serialized_ir_layer>(es, ee.getIRTransformLayer(), compile_mutex);
+      lazy_layer = std::make_unique<llvm::orc::CompileOnDemandLayer>(
+        es,
+        *serialized_layer,
+        *lazy_call_through,
+        llvm::orc::createLocalIndirectStubsManagerBuilder(ee.getTargetTriple()));
+      lazy_layer->setPartitionFunction(llvm::orc::CompileOnDemandLayer::compileRequested);
+    }
+
+    if(opts.tier_up_threshold != 0)
+    {
+      tier_up_threshold = opts.tier_up_threshold;
+      tiers = std::make_unique<tier_compiler>(interpreter->getExecutionEngine().get(),
+                                              compile_mutex);
+    }
+
+    if(opts.jit_cache)
+    {
+      object_cache_dir = util::format(
+        "{}/jit/{}",
+        util::user_cache_dir(),
+        util::binary_version(opts.optimization_level, opts.include_dirs, opts.define_macros));
+      object_cache_build = object_cache_build_id();
+      evict_cached_objects(object_cache_dir);
+    }
+
     auto const &load_result{ load_dynamic_libs(opts.libs) };
     if(load_result.is_err())
     {
@@ -153,8 +682,9 @@ namespace jank::jit
 
   void processor::eval_string(jtl::immutable_string const &s) const
   {
-    profile::timer const timer{ "jit eval_string" };
+    profile::timer const timer{ profile::region<"jit eval_string"> };
     //util::println("// eval_string:\n{}\n", s);
+    std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
     auto err(interpreter->ParseAndExecute({ s.data(), s.size() }));
     llvm::logAllUnhandledErrors(std::move(err), llvm::errs(), "error: ");
   }
@@ -170,15 +700,78 @@ namespace jank::jit
     /* XXX: Object files won't be able to use global ctors until jank is on the ORC
      * runtime, which likely won't happen until clang::Interpreter is on the ORC runtime. */
     /* TODO: Return result on failure. */
+    std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
     llvm::cantFail(ee.addObjectFile(std::move(file.get())));
     register_jit_stack_frames();
   }
 
+  /* A recompiled body is loaded in its own module, so anything local to a tiered module
+   * which it may reference needs to be visible to it. We give each such symbol a name
+   * unique to this module and make it external. */
+  static void expose_module_locals(llvm::Module &m)
+  {
+    for(auto &gv : m.global_values())
+    {
+      if(!gv.hasLocalLinkage() || !gv.hasName())
+      {
+        continue;
+      }
+      if(auto const var{ llvm::dyn_cast<llvm::GlobalVariable>(&gv) }; var && var->isConstant())
+      {
+        continue;
+      }
+      gv.setName(util::format("{}.{}",
+                              static_cast<std::string_view>(m.getModuleIdentifier()),
+                              static_cast<std::string_view>(gv.getName()))
+                   .c_str());
+      gv.setLinkage(llvm::GlobalValue::ExternalLinkage);
+    }
+  }
+
+  /* Fns which never get hot keep their tiered module around forever, so we stop keeping
+   * new ones once we're holding this much. Their fns just stay on their first tier. */
+  static constexpr usize max_pending_tier_bytes{ 64 * 1024 * 1024 };
+
+  /* This needs to be called before the module is handed to the JIT, since it uses the
+   * module's context. */
+  static void register_tiered_module(tier_compiler &tiers,
+                                     llvm::Module const &m,
+                                     native_vector<jtl::immutable_string> const &bodies)
+  {
+    if(max_pending_tier_bytes <= tiers.pending_bytes.load())
+    {
+      return;
+    }
+
+    std::unordered_set<std::string> body_names;
+    for(auto const &body : bodies)
+    {
+      body_names.emplace(body.c_str());
+    }
+
+    auto const trimmed(llvm::CloneModule(m));
+    keep_only_bodies(*trimmed, body_names);
+    std::string bitcode;
+    llvm::raw_string_ostream os{ bitcode };
+    llvm::WriteBitcodeToFile(*trimmed, os);
+    os.flush();
+
+    auto const module(std::make_shared<tiered_module>(std::move(bitcode), tiers.pending_bytes));
+    std::lock_guard<std::mutex> const lock{ tiers.mutex };
+    for(auto const &body : body_names)
+    {
+      tiers.modules[body] = module;
+    }
+  }
+
   void processor::load_ir_module(std::unique_ptr<llvm::Module> m,
-                                 std::unique_ptr<llvm::LLVMContext> llvm_ctx) const
+                                 std::unique_ptr<llvm::LLVMContext> llvm_ctx,
+                                 jtl::immutable_string const &cache_path,
+                                 native_vector<jtl::immutable_string> const &tiered_fns) const
   {
-    profile::timer const timer{ util::format("jit ir module {}",
-                                             static_cast<std::string_view>(m->getName())) };
+    profile::timer const timer{ [&] {
+      return util::format("jit ir module {}", static_cast<std::string_view>(m->getName()));
+    } };
     //m->print(llvm::outs(), nullptr);
 
 #if JANK_DEBUG
@@ -190,13 +783,179 @@ namespace jank::jit
     }
 #endif
 
+    if(tiers && !tiered_fns.empty())
+    {
+      expose_module_locals(*m);
+      register_tiered_module(*tiers, *m, tiered_fns);
+    }
+    llvm::orc::ThreadSafeContext const tsc{ std::move(llvm_ctx) };
+
     auto &ee(interpreter->getExecutionEngine().get());
-    llvm::cantFail(
-      ee.addIRModule(llvm::orc::ThreadSafeModule{ std::move(m), std::move(llvm_ctx) }));
+    if(lazy_layer)
+    {
+      /* The JIT's platform support only learns about global ctors once a module reaches
+       * its layers, but the compile on demand layer won't send anything there until it's
+       * needed. So we pull the ctors out and run them ourselves, which will compile them
+       * and whatever they call. */
+      auto const ctors(take_global_ctors(*m));
+
+      /* We don't compile the whole module up front just to cache it, since that would undo
+       * lazy compilation. Modules are only cached when they're compiled eagerly. */
+      {
+        std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
+        llvm::cantFail(lazy_layer->add(ee.getMainJITDylib(),
+                                       llvm::orc::ThreadSafeModule{ std::move(m), tsc }));
+      }
+      run_global_ctors(ee, compile_mutex, ctors);
+      return;
+    }
+
+    if(!cache_path.empty())
+    {
+      /* Without lazy compilation, we're compiling the whole module now anyway, so we
+       * compile it to an object ourselves, which we can both cache and load. */
+      auto const ctors(take_global_ctors(*m));
+      llvm::SmallVector<char, 0> object;
+      if(compile_object(*m, optimization_level, object).is_ok())
+      {
+        if(store_cached_object(object_cache_dir, cache_path, object)
+           && object_cache_bytes_written.fetch_add(object.size()) + object.size()
+             >= object_cache_evict_interval_bytes)
+        {
+          object_cache_bytes_written = 0;
+          evict_cached_objects(object_cache_dir);
+        }
+        {
+          std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
+          llvm::cantFail(ee.addObjectFile(llvm::MemoryBuffer::getMemBufferCopy(
+            llvm::StringRef{ object.data(), object.size() },
+            static_cast<std::string_view>(m->getName()))));
+          register_jit_stack_frames();
+        }
+        {
+          /* The module needs to go before its context. */
+          auto const lock(tsc.getLock());
+          m.reset();
+        }
+        run_global_ctors(ee, compile_mutex, ctors);
+        return;
+      }
+
+      /* The ctors are gone from the module now, but compile_object bails out before
+       * touching it, so we can still JIT compile it as usual. */
+      {
+        std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
+        llvm::cantFail(ee.addIRModule(llvm::orc::ThreadSafeModule{ std::move(m), tsc }));
+        register_jit_stack_frames();
+      }
+      run_global_ctors(ee, compile_mutex, ctors);
+      return;
+    }
+
+    std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
+    llvm::cantFail(ee.addIRModule(llvm::orc::ThreadSafeModule{ std::move(m), tsc }));
     llvm::cantFail(ee.initialize(ee.getMainJITDylib()));
     register_jit_stack_frames();
   }
 
+  jtl::immutable_string processor::object_cache_path(llvm::Module const &m) const
+  {
+    if(object_cache_dir.empty())
+    {
+      return {};
+    }
+
+    /* The IR is the analyzed form, fully lowered, so it captures everything which could
+     * affect the generated code, including the unique names of every symbol we define. The
+     * compiler flags are already part of the cache dir. Everything else, like the host CPU
+     * and this build of jank, is in the build id. */
+    std::string ir;
+    llvm::raw_string_ostream ir_os{ ir };
+    ir_os << object_cache_build << '\n' << m;
+    ir_os.flush();
+    return util::format("{}/{}.o", object_cache_dir, util::sha256(ir));
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer>
+  processor::find_cached_object(jtl::immutable_string const &cache_path) const
+  {
+    if(cache_path.empty())
+    {
+      return nullptr;
+    }
+
+    /* Another process may evict the object at any point, so we read it in now rather
+     * than checking whether it exists. */
+    auto file{ llvm::MemoryBuffer::getFile(cache_path.c_str()) };
+    if(!file)
+    {
+      return nullptr;
+    }
+
+    /* Eviction goes by last use, so we need to mark this as used. */
+    std::error_code error{};
+    std::filesystem::last_write_time(cache_path.c_str(),
+                                     std::filesystem::file_time_type::clock::now(),
+                                     error);
+    return std::move(file.get());
+  }
+
+  void
+  processor::load_cached_object(std::unique_ptr<llvm::MemoryBuffer> object,
+                                std::unique_ptr<llvm::Module> m,
+                                std::unique_ptr<llvm::LLVMContext> llvm_ctx,
+                                native_vector<jtl::immutable_string> const &tiered_fns) const
+  {
+    profile::timer const timer{ [&] {
+      return util::format("jit cached ir module {}", static_cast<std::string_view>(m->getName()));
+    } };
+
+    /* The cached object was compiled after its locals were exposed, so we need to do the
+     * same here to find its ctors by name. */
+    if(tiers && !tiered_fns.empty())
+    {
+      expose_module_locals(*m);
+      register_tiered_module(*tiers, *m, tiered_fns);
+    }
+    auto const ctors(take_global_ctors(*m));
+    /* The module needs to go before its context. */
+    m.reset();
+    llvm_ctx.reset();
+
+    auto &ee(interpreter->getExecutionEngine().get());
+    {
+      std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
+      llvm::cantFail(ee.addObjectFile(std::move(object)));
+      register_jit_stack_frames();
+    }
+    run_global_ctors(ee, compile_mutex, ctors);
+  }
+
+  usize processor::tiered_up_count() const
+  {
+    return tiers ? tiers->completed.load() : 0;
+  }
+
+  void processor::tier_up(jtl::immutable_string const &body_name, void ** const tier) const
+  {
+    if(!tiers)
+    {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> const lock{ tiers->mutex };
+      auto const found(tiers->modules.find(body_name.c_str()));
+      if(found == tiers->modules.end())
+      {
+        return;
+      }
+      tiers->queue.push_back({ found->first, tier, std::move(found->second) });
+      tiers->modules.erase(found);
+    }
+    tiers->cv.notify_one();
+  }
+
   void processor::load_bitcode(jtl::immutable_string const &module,
                                native_persistent_string_view const &bitcode) const
   {
@@ -221,6 +980,7 @@ namespace jank::jit
     auto &ee{ interpreter->getExecutionEngine().get() };
     llvm::orc::SymbolNameSet to_remove{};
     to_remove.insert(ee.mangleAndIntern(name.c_str()));
+    std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
     auto const error{ ee.getMainJITDylib().remove(to_remove) };
 
     if(error.isA<llvm::orc::SymbolsCouldNotBeRemoved>())
@@ -282,6 +1042,7 @@ namespace jank::jit
 
   void processor::load_dynamic_library(jtl::immutable_string const &path) const
   {
+    std::lock_guard<std::recursive_mutex> const lock{ compile_mutex };
     llvm::cantFail(interpreter->LoadDynamicLibrary(path.data()));
   }
 }
@@ -23,6 +23,8 @@ jank_object_ref jank_load_jank_perf_native()
           make_box(obj::symbol{ __rt_ctx->current_ns()->to_string(), name }.to_string())))));
   });
   intern_fn("benchmark", &perf::benchmark);
+  intern_fn("start-sampling", &perf::start_sampling);
+  intern_fn("stop-sampling", &perf::stop_sampling);
 
   return jank_nil.erase();
 }
@@ -0,0 +1,250 @@
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/time.h>
+
+#include <cpptrace/basic.hpp>
+#include <cpptrace/cpptrace.hpp>
+
+#include <jank/profile/sample.hpp>
+#include <jank/runtime/core/munge.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/util/string_builder.hpp>
+
+namespace jank::profile::sample
+{
+  static constexpr usize max_depth{ 64 };
+  static constexpr usize max_samples{ 16 * 1024 };
+
+  struct stack_sample
+  {
+    usize depth{};
+    std::array<cpptrace::frame_ptr, max_depth> frames{};
+  };
+
+  /* The signal handler can't allocate or lock, so all of the samples are allocated up front
+   * and claimed with an atomic index. Once they're all claimed, further samples are dropped.
+   *
+   * Handlers may still be running on other threads when sampling stops, so each handler
+   * counts itself as a writer while it's in there. Stopping turns off accepting and then
+   * waits for the writers to finish before reading any samples. */
+  struct sampler_state
+  {
+    std::unique_ptr<stack_sample[]> samples;
+    std::atomic<usize> next_sample{};
+    std::atomic<usize> writers{};
+    std::atomic<bool> accepting{};
+    struct sigaction previous_action{};
+    bool running{};
+  };
+
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::mutex state_mutex;
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static sampler_state state;
+
+  static void on_sigprof(int, siginfo_t *, void *)
+  {
+    auto const saved_errno(errno);
+    ++state.writers;
+    if(state.accepting.load())
+    {
+      auto const index(state.next_sample.fetch_add(1, std::memory_order_relaxed));
+      if(index < max_samples)
+      {
+        auto &s(state.samples[index]);
+        /* Skip this handler's own frame. */
+        s.depth = cpptrace::safe_generate_raw_trace(s.frames.data(), max_depth, 1);
+      }
+    }
+    --state.writers;
+    errno = saved_errno;
+  }
+
+  static bool set_timer(u32 const frequency)
+  {
+    itimerval timer{};
+    if(frequency)
+    {
+      /* tv_usec needs to be less than a full second, so 1 Hz is a whole second instead. */
+      auto const interval(1'000'000 / frequency);
+      timer.it_interval.tv_sec = static_cast<time_t>(interval / 1'000'000);
+      timer.it_interval.tv_usec = static_cast<suseconds_t>(interval % 1'000'000);
+      timer.it_value = timer.it_interval;
+    }
+    return setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+  }
+
+  /* Putting back the default action for SIGPROF would mean that a signal which was already
+   * on its way terminates the process, so we ignore it instead. */
+  static void restore_action()
+  {
+    auto previous(state.previous_action);
+    if(!(previous.sa_flags & SA_SIGINFO) && previous.sa_handler == SIG_DFL)
+    {
+      previous.sa_handler = SIG_IGN;
+    }
+    sigaction(SIGPROF, &previous, nullptr);
+  }
+
+  jtl::string_result<void> start(u32 const frequency)
+  {
+    std::lock_guard const lock{ state_mutex };
+    if(state.running)
+    {
+      return err("The sampling profiler is already running.");
+    }
+    if(frequency == 0 || 1'000'000 < frequency)
+    {
+      return err(util::format("Invalid sampling frequency: {}", frequency));
+    }
+    /* Without this, every sample would have an empty stack. */
+    if(!cpptrace::can_signal_safe_unwind())
+    {
+      return err("The sampling profiler needs cpptrace to be built with libunwind, so it can "
+                 "unwind from within a signal handler.");
+    }
+
+    if(!state.samples)
+    {
+      state.samples = std::make_unique<stack_sample[]>(max_samples);
+    }
+    state.next_sample.store(0);
+    state.accepting.store(true);
+
+    /* The first unwind may need to allocate, so we do one now, outside of a signal handler. */
+    std::array<cpptrace::frame_ptr, 1> warm_up{};
+    cpptrace::safe_generate_raw_trace(warm_up.data(), warm_up.size());
+
+    struct sigaction action{};
+    action.sa_sigaction = &on_sigprof;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if(sigaction(SIGPROF, &action, &state.previous_action) != 0)
+    {
+      return err("Unable to install the SIGPROF handler.");
+    }
+
+    if(!set_timer(frequency))
+    {
+      state.accepting.store(false);
+      restore_action();
+      return err(util::format("Unable to start the sampling timer at {} Hz.", frequency));
+    }
+    state.running = true;
+    return ok();
+  }
+
+  /* Native frames are named by their demangled C++ names. JIT compiled jank fns have munged
+   * names, so we demunge those back into something closer to the jank source. */
+  static std::string frame_name(cpptrace::stacktrace_frame const &frame)
+  {
+    if(frame.symbol.empty())
+    {
+      auto const address(util::format("{}", reinterpret_cast<void const *>(frame.raw_address)));
+      return { address.data(), address.size() };
+    }
+
+    std::string name{ frame.symbol };
+    if(name.find("::") == std::string::npos && name.find('(') == std::string::npos)
+    {
+      auto const demunged(runtime::demunge(name));
+      name = std::string{ demunged.data(), demunged.size() };
+    }
+
+    /* Semicolons separate frames in the folded format. */
+    for(auto &c : name)
+    {
+      if(c == ';')
+      {
+        c = ':';
+      }
+    }
+    return name;
+  }
+
+  jtl::string_result<jtl::immutable_string> stop()
+  {
+    std::lock_guard const lock{ state_mutex };
+    if(!state.running)
+    {
+      return err("The sampling profiler isn't running.");
+    }
+
+    set_timer(0);
+    state.accepting.store(false);
+    while(state.writers.load() != 0)
+    {
+      std::this_thread::yield();
+    }
+    restore_action();
+    state.running = false;
+
+    auto const total(state.next_sample.load());
+    auto const count(std::min(total, max_samples));
+
+    /* Each address may resolve to more than one frame, due to inlining. These are innermost
+     * first, like the raw frames. */
+    std::map<cpptrace::frame_ptr, std::vector<std::string>> names;
+    std::map<std::string, usize> stacks;
+    for(usize i{}; i < count; ++i)
+    {
+      auto const &s(state.samples[i]);
+      std::vector<std::string const *> frames;
+      for(usize f{}; f < s.depth; ++f)
+      {
+        auto const address(s.frames[f]);
+        auto found(names.find(address));
+        if(found == names.end())
+        {
+          std::vector<std::string> resolved;
+          for(auto const &frame : cpptrace::raw_trace{ { address } }.resolve().frames)
+          {
+            resolved.emplace_back(frame_name(frame));
+          }
+          found = names.emplace(address, std::move(resolved)).first;
+        }
+        for(auto const &name : found->second)
+        {
+          frames.emplace_back(&name);
+        }
+      }
+
+      std::string stack;
+      for(auto it(frames.rbegin()); it != frames.rend(); ++it)
+      {
+        if(!stack.empty())
+        {
+          stack += ';';
+        }
+        stack += **it;
+      }
+      ++stacks[stack];
+    }
+
+    util::string_builder sb;
+    for(auto const &stack : stacks)
+    {
+      sb(stack.first)(' ')(stack.second)('\n');
+    }
+    if(max_samples < total)
+    {
+      sb("[dropped] ")(total - max_samples)('\n');
+    }
+    return ok(sb.release());
+  }
+
+  bool is_running()
+  {
+    std::lock_guard const lock{ state_mutex };
+    return state.running;
+  }
+}
@@ -1,78 +1,393 @@
+#include <algorithm>
+#include <array>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <jank/profile/time.hpp>
+#include <jank/util/fmt.hpp>
 #include <jank/util/fmt/print.hpp>
 
+/* Profile output is binary, to keep the enabled path cheap. The file starts with the magic
+ * `jankprof` and a u32 version. After that, it's a sequence of blocks, each starting with a
+ * one byte tag:
+ *
+ * - 'r': u32 region id, u32 label size, label bytes
+ * - 't': u32 thread index, u32 record count, then that many records
+ *
+ * Each record is a u64 steady clock time in nanoseconds, a u32 region id, and a u32 kind
+ * (0 for enter, 1 for exit, 2 for report). All numbers are in native byte order. Regions
+ * are always written before the first records which refer to them. `jank profile-report`
+ * decodes this back into text. */
+
 namespace jank::profile
 {
-  static constexpr native_persistent_string_view tag{ "jank::profile" };
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-  static bool enabled{};
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-  static std::ofstream output;
+  namespace detail
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    bool enabled{};
+  }
+
+  static constexpr u32 format_version{ 1 };
+
+  enum class record_kind : u32
+  {
+    enter,
+    exit,
+    report
+  };
+
+  struct record
+  {
+    u64 time{};
+    region_id region{};
+    record_kind kind{};
+  };
+
+  struct region_registry
+  {
+    std::mutex mutex;
+    std::map<std::string, region_id, std::less<>> ids;
+    /* Indexed by region id - 1. */
+    std::vector<std::string> labels;
+  };
+
+  struct profile_writer
+  {
+    std::mutex mutex;
+    std::ofstream output;
+    usize written_regions{};
+    u32 next_thread{};
+  };
+
+  static region_registry &regions()
+  {
+    static region_registry ret;
+    return ret;
+  }
+
+  static profile_writer &writer()
+  {
+    static profile_writer ret;
+    return ret;
+  }
+
+  template <typename T>
+  static void write_raw(std::ofstream &output, T const &data)
+  {
+    output.write(reinterpret_cast<char const *>(&data), sizeof(T));
+  }
+
+  /* Each thread buffers its records and only takes the writer's lock to flush them, once the
+   * buffer is full or the thread exits. */
+  struct thread_buffer
+  {
+    static constexpr usize capacity{ 16 * 1024 };
+
+    thread_buffer()
+      : records{ std::make_unique<record[]>(capacity) }
+    {
+      auto &w(writer());
+      std::lock_guard const lock{ w.mutex };
+      thread = w.next_thread++;
+    }
 
-  static auto now()
+    ~thread_buffer()
+    try
+    {
+      flush();
+    }
+    catch(...)
+    {
+      /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): I need to log without exceptions. */
+      std::printf("Exception caught while flushing profile records");
+    }
+
+    void push(record const &r)
+    {
+      records[size++] = r;
+      if(size == capacity)
+      {
+        flush();
+      }
+    }
+
+    void flush()
+    {
+      if(size == 0)
+      {
+        return;
+      }
+
+      auto &w(writer());
+      std::lock_guard const lock{ w.mutex };
+      if(w.output.is_open())
+      {
+        {
+          auto &r(regions());
+          std::lock_guard const regions_lock{ r.mutex };
+          for(; w.written_regions < r.labels.size(); ++w.written_regions)
+          {
+            auto const &label(r.labels[w.written_regions]);
+            w.output.put('r');
+            write_raw(w.output, static_cast<region_id>(w.written_regions + 1));
+            write_raw(w.output, static_cast<u32>(label.size()));
+            w.output.write(label.data(), static_cast<std::streamsize>(label.size()));
+          }
+        }
+
+        w.output.put('t');
+        write_raw(w.output, thread);
+        write_raw(w.output, static_cast<u32>(size));
+        w.output.write(reinterpret_cast<char const *>(records.get()),
+                       static_cast<std::streamsize>(size * sizeof(record)));
+        w.output.flush();
+      }
+      size = 0;
+    }
+
+    std::unique_ptr<record[]> records;
+    usize size{};
+    u32 thread{};
+  };
+
+  static thread_buffer &current_buffer()
+  {
+    static thread_local thread_buffer ret;
+    return ret;
+  }
+
+  static u64 now()
   {
     using namespace std::chrono;
     return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
   }
 
+  static void push(region_id const id, record_kind const kind)
+  {
+    current_buffer().push({ now(), id, kind });
+  }
+
   void configure(util::cli::options const &opts)
   {
-    enabled = opts.profiler_enabled;
+    if(!opts.profiler_enabled)
+    {
+      return;
+    }
 
-    if(enabled)
+    auto &w(writer());
+    std::lock_guard const lock{ w.mutex };
+    w.output.open(opts.profiler_file.data(), std::ios::binary | std::ios::trunc);
+    if(!w.output.is_open())
     {
-      output.open(opts.profiler_file.data());
-      if(!output.is_open())
-      {
-        enabled = false;
-        util::println(stderr,
-                      "Unable to open profile file: {}\nProfiling is now disabled.",
-                      opts.profiler_file);
-      }
+      util::println(stderr,
+                    "Unable to open profile file: {}\nProfiling is now disabled.",
+                    opts.profiler_file);
+      return;
     }
+
+    w.output.write("jankprof", 8);
+    write_raw(w.output, format_version);
+    detail::enabled = true;
   }
 
-  bool is_enabled()
+  region_id intern_region(native_persistent_string_view const &label)
   {
-    return enabled;
+    auto &r(regions());
+    std::lock_guard const lock{ r.mutex };
+    auto const found(r.ids.find(label));
+    if(found != r.ids.end())
+    {
+      return found->second;
+    }
+
+    r.labels.emplace_back(label);
+    auto const id(static_cast<region_id>(r.labels.size()));
+    r.ids.emplace(r.labels.back(), id);
+    return id;
   }
 
-  void enter(native_persistent_string_view const &region)
+  void enter(region_id const id)
   {
-    if(enabled)
+    if(is_enabled())
     {
-      output << util::format("{} {} enter {}", tag, now(), region);
+      push(id, record_kind::enter);
     }
   }
 
-  void exit(native_persistent_string_view const &region)
+  void exit(region_id const id)
   {
-    if(enabled)
+    if(is_enabled())
     {
-      output << util::format("{} {} exit {}", tag, now(), region);
+      push(id, record_kind::exit);
     }
   }
 
   void report(native_persistent_string_view const &boundary)
   {
-    if(enabled)
+    if(is_enabled())
+    {
+      push(intern_region(boundary), record_kind::report);
+    }
+  }
+
+  void finish()
+  {
+    if(!is_enabled())
+    {
+      return;
+    }
+
+    current_buffer().flush();
+    detail::enabled = false;
+
+    auto &w(writer());
+    std::lock_guard const lock{ w.mutex };
+    w.output.close();
+    w.written_regions = 0;
+  }
+
+  template <typename T>
+  static bool read_raw(std::ifstream &input, T &data)
+  {
+    return static_cast<bool>(input.read(reinterpret_cast<char *>(&data), sizeof(T)));
+  }
+
+  static char const *record_kind_str(record_kind const kind)
+  {
+    switch(kind)
+    {
+      case record_kind::enter:
+        return "enter";
+      case record_kind::exit:
+        return "exit";
+      case record_kind::report:
+        return "report";
+    }
+    return "unknown";
+  }
+
+  jtl::string_result<jtl::immutable_string> decode(jtl::immutable_string const &path)
+  {
+    std::ifstream input{ path.c_str(), std::ios::binary };
+    if(!input.is_open())
+    {
+      return err(util::format("Unable to open profile file: {}", path));
+    }
+
+    std::array<char, 8> magic{};
+    u32 version{};
+    if(!input.read(magic.data(), magic.size())
+       || std::string_view{ magic.data(), magic.size() } != "jankprof"
+       || !read_raw(input, version))
+    {
+      return err(util::format("Not a jank profile: {}", path));
+    }
+    if(version != format_version)
+    {
+      return err(util::format("Unsupported jank profile version {} in {}", version, path));
+    }
+
+    struct thread_record
+    {
+      record r;
+      u32 thread{};
+    };
+
+    std::vector<std::string> labels;
+    std::vector<thread_record> records;
+    auto const truncated([&] { return err(util::format("Truncated jank profile: {}", path)); });
+    for(char tag{}; input.get(tag);)
+    {
+      if(tag == 'r')
+      {
+        region_id id{};
+        u32 size{};
+        if(!read_raw(input, id) || !read_raw(input, size))
+        {
+          return truncated();
+        }
+        std::string label(size, '\0');
+        if(!input.read(label.data(), size))
+        {
+          return truncated();
+        }
+        /* Regions are written in order, so their ids match their position. */
+        if(id != labels.size() + 1)
+        {
+          return err(util::format("Out of order region {} in jank profile: {}", id, path));
+        }
+        labels.emplace_back(std::move(label));
+      }
+      else if(tag == 't')
+      {
+        u32 thread{};
+        u32 count{};
+        if(!read_raw(input, thread) || !read_raw(input, count))
+        {
+          return truncated();
+        }
+        for(u32 i{}; i < count; ++i)
+        {
+          thread_record tr{ {}, thread };
+          if(!read_raw(input, tr.r))
+          {
+            return truncated();
+          }
+          if(tr.r.region == 0 || labels.size() < tr.r.region)
+          {
+            return err(
+              util::format("Unknown region {} in jank profile: {}", tr.r.region, path));
+          }
+          records.emplace_back(tr);
+        }
+      }
+      else
+      {
+        return err(util::format("Unknown block in jank profile: {}", path));
+      }
+    }
+
+    /* Each thread's records are written together, so we interleave them back into one
+     * timeline. Records with the same time keep the order they were written in. */
+    std::stable_sort(records.begin(),
+                     records.end(),
+                     [](thread_record const &l, thread_record const &r) {
+                       return l.r.time < r.r.time;
+                     });
+
+    util::string_builder sb;
+    for(auto const &tr : records)
     {
-      output << util::format("{} {} report {}", tag, now(), boundary);
+      util::format_to(sb,
+                      "jank::profile {} {} {} {}\n",
+                      tr.r.time,
+                      tr.thread,
+                      record_kind_str(tr.r.kind),
+                      labels[tr.r.region - 1]);
     }
+    return ok(sb.release());
   }
 
-  timer::timer(native_persistent_string_view const &region)
-    : region{ region }
+  timer::timer(region_id const id)
   {
-    enter(region);
+    if(is_enabled())
+    {
+      this->id = id;
+      enter(id);
+    }
   }
 
   timer::~timer()
   try
   {
-    exit(region);
+    if(id)
+    {
+      exit(id);
+    }
   }
   catch(...)
   {
@@ -0,0 +1,885 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <jank/read/data.hpp>
+#include <jank/read/ascii_scan.hpp>
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/visit.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/behavior/metadatable.hpp>
+#include <jank/runtime/detail/native_persistent_array_map.hpp>
+#include <jank/runtime/obj/character.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_hash_set.hpp>
+#include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/ratio.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/util/escape.hpp>
+
+namespace jank::read::data
+{
+  using namespace jank::runtime;
+
+  static bool is_digit(char const c)
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  /* The characters the lexer accepts at the start of a symbol, aside from digits, which
+   * start numbers. */
+  static bool is_symbol_start(char const c)
+  {
+    switch(c)
+    {
+      case 'a' ... 'z':
+      case 'A' ... 'Z':
+      case '_':
+      case '/':
+      case '?':
+      case '+':
+      case '-':
+      case '=':
+      case '*':
+      case '!':
+      case '&':
+      case '<':
+      case '>':
+      case '%':
+      case '.':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /* How many bytes the UTF-8 sequence at the start of [it, end) takes up, or 0 if it's not
+   * valid. */
+  static usize utf8_length(char const * const it, char const * const end)
+  {
+    auto const lead(static_cast<u8>(*it));
+    usize length{};
+    if(lead >= 0xC2 && lead <= 0xDF)
+    {
+      length = 2;
+    }
+    else if(lead >= 0xE0 && lead <= 0xEF)
+    {
+      length = 3;
+    }
+    else if(lead >= 0xF0 && lead <= 0xF4)
+    {
+      length = 4;
+    }
+    else
+    {
+      return 0;
+    }
+
+    if(static_cast<usize>(end - it) < length)
+    {
+      return 0;
+    }
+    for(usize i{ 1 }; i < length; ++i)
+    {
+      if((static_cast<u8>(it[i]) & 0xC0) != 0x80)
+      {
+        return 0;
+      }
+    }
+    return length;
+  }
+
+  /* Plain decimal integers and reals, which is nearly every number in data. Anything
+   * fancier, such as a radix, a ratio, or an integer which might not fit, is left to the
+   * lexer. */
+  static jtl::option<object_ref> read_plain_number(native_persistent_string_view const &s)
+  {
+    usize const digits_start{ s[0] == '-' ? 1llu : 0llu };
+    auto i(digits_start);
+    while(i < s.size() && is_digit(s[i]))
+    {
+      ++i;
+    }
+    auto const digits(i - digits_start);
+    if(digits == 0)
+    {
+      return none;
+    }
+
+    if(i == s.size())
+    {
+      /* A leading 0 means octal. */
+      if((digits > 1 && s[digits_start] == '0') || digits > 18)
+      {
+        return none;
+      }
+      i64 n{};
+      for(auto d(digits_start); d < s.size(); ++d)
+      {
+        n = n * 10 + (s[d] - '0');
+      }
+      return make_box<obj::integer>(digits_start == 0 ? n : -n).erase();
+    }
+
+    if(s[i] == '.')
+    {
+      ++i;
+      while(i < s.size() && is_digit(s[i]))
+      {
+        ++i;
+      }
+    }
+    if(i < s.size() && (s[i] == 'e' || s[i] == 'E'))
+    {
+      ++i;
+      if(i < s.size() && (s[i] == '+' || s[i] == '-'))
+      {
+        ++i;
+      }
+      auto const exponent_start(i);
+      while(i < s.size() && is_digit(s[i]))
+      {
+        ++i;
+      }
+      if(i == exponent_start)
+      {
+        return none;
+      }
+    }
+
+    /* strtod needs a terminator, which the input may not have right after the number. */
+    std::array<char, 64> buffer{};
+    if(i != s.size() || s.size() >= buffer.size())
+    {
+      return none;
+    }
+    std::memcpy(buffer.data(), s.data(), s.size());
+    return make_box<obj::real>(std::strtod(buffer.data(), nullptr)).erase();
+  }
+
+  reader::reader(native_persistent_string_view const &input, bool const source_meta)
+    : input{ input }
+    , source_meta{ source_meta }
+  {
+  }
+
+  reader::result reader::next()
+  {
+    return read_item(0);
+  }
+
+  source_position reader::position_at(usize const offset)
+  {
+    jank_debug_assert(cursor.offset <= offset);
+
+    native_persistent_string_view const skipped{ input.data() + cursor.offset,
+                                                 offset - cursor.offset };
+    auto const newlines(std::ranges::count(skipped, '\n'));
+    if(newlines == 0)
+    {
+      cursor.col += skipped.size();
+    }
+    else
+    {
+      cursor.line += static_cast<usize>(newlines);
+      cursor.col = skipped.size() - skipped.rfind('\n');
+    }
+    cursor.offset = offset;
+    return cursor;
+  }
+
+  source_position reader::mark()
+  {
+    return source_meta ? position_at(pos) : source_position{};
+  }
+
+  jtl::option<object_ref> reader::meta_since(source_position const &start)
+  {
+    if(!source_meta)
+    {
+      return none;
+    }
+    return source_to_meta(start, position_at(pos)).erase();
+  }
+
+  void reader::skip_space()
+  {
+    auto const end(input.data() + input.size());
+    while(pos < input.size())
+    {
+      auto const space(ascii_scan::whitespace(input.data() + pos, end));
+      if(space != 0)
+      {
+        pos += space;
+        require_space = false;
+        continue;
+      }
+
+      auto const c(input[pos]);
+      if(c != ';' && (c != '#' || pos + 1 == input.size() || input[pos + 1] != '!'))
+      {
+        return;
+      }
+
+      /* Comments run to the end of the line. Only ASCII can end one, so any other bytes are
+       * stepped over one at a time. */
+      ++pos;
+      while(pos < input.size() && input[pos] != '\n')
+      {
+        pos += ascii_scan::comment(input.data() + pos, end);
+        if(pos < input.size() && input[pos] != '\n')
+        {
+          ++pos;
+        }
+      }
+    }
+  }
+
+  usize reader::atom_end(usize const from) const
+  {
+    return from + ascii_scan::symbol(input.data() + from, input.data() + input.size());
+  }
+
+  reader::result reader::read_item(char const closer)
+  {
+    while(true)
+    {
+      skip_space();
+      if(pos == input.size())
+      {
+        if(closer != 0)
+        {
+          return err(unsupported{});
+        }
+        return ok(none);
+      }
+
+      auto const c(input[pos]);
+      if(c == ')' || c == ']' || c == '}')
+      {
+        if(c != closer)
+        {
+          return err(unsupported{});
+        }
+        ++pos;
+        require_space = false;
+        return ok(none);
+      }
+
+      if(c == '#' && pos + 1 < input.size() && input[pos + 1] == '_')
+      {
+        if(require_space)
+        {
+          return err(unsupported{});
+        }
+        pos += 2;
+        if(read_required().is_err())
+        {
+          return err(unsupported{});
+        }
+        continue;
+      }
+
+      auto form(read_form());
+      if(form.is_err())
+      {
+        return err(unsupported{});
+      }
+      return ok(some(form.expect_ok()));
+    }
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_required()
+  {
+    auto const item(read_item(0));
+    if(item.is_err() || item.expect_ok().is_none())
+    {
+      return err(unsupported{});
+    }
+    return ok(item.expect_ok().unwrap());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_form()
+  {
+    auto const c(input[pos]);
+    switch(c)
+    {
+      case '(':
+        require_space = false;
+        return read_list();
+      case '[':
+        require_space = false;
+        return read_vector();
+      case '{':
+        require_space = false;
+        return read_map();
+      case '\\':
+        require_space = false;
+        return read_character();
+      case '\'':
+      case '`':
+      case '~':
+      case '@':
+        return err(unsupported{});
+      default:
+        break;
+    }
+
+    /* Like the lexer, we require whitespace between atoms, strings, and reader macros. */
+    if(require_space)
+    {
+      return err(unsupported{});
+    }
+
+    switch(c)
+    {
+      case '"':
+        return read_string();
+      case '^':
+        return read_meta_hint();
+      case '#':
+        if(pos + 1 < input.size() && input[pos + 1] == '{')
+        {
+          return read_set();
+        }
+        if(pos + 1 < input.size() && input[pos + 1] == '#')
+        {
+          return read_symbolic_value();
+        }
+        return err(unsupported{});
+      default:
+        return read_atom();
+    }
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_list()
+  {
+    auto const start(mark());
+    ++pos;
+
+    native_vector<object_ref> ret;
+    while(true)
+    {
+      auto const item(read_item(')'));
+      if(item.is_err())
+      {
+        return err(unsupported{});
+      }
+      if(item.expect_ok().is_none())
+      {
+        break;
+      }
+      ret.emplace_back(item.expect_ok().unwrap());
+    }
+
+    auto const meta(meta_since(start));
+    if(meta.is_some())
+    {
+      return ok(
+        make_box<obj::persistent_list>(meta.unwrap(), std::in_place, ret.rbegin(), ret.rend())
+          .erase());
+    }
+    return ok(make_box<obj::persistent_list>(std::in_place, ret.rbegin(), ret.rend()).erase());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_vector()
+  {
+    auto const start(mark());
+    ++pos;
+
+    runtime::detail::native_transient_vector ret;
+    while(true)
+    {
+      auto const item(read_item(']'));
+      if(item.is_err())
+      {
+        return err(unsupported{});
+      }
+      if(item.expect_ok().is_none())
+      {
+        break;
+      }
+      ret.push_back(item.expect_ok().unwrap());
+    }
+
+    return ok(make_box<obj::persistent_vector>(meta_since(start), ret.persistent()).erase());
+  }
+
+  /* Maps start out as array maps, like any other, and are promoted to hash maps once they
+   * grow past what an array map holds, rather than having every entry search all of the
+   * entries before it. The parser does the same, so both give the same map. */
+  jtl::result<object_ref, unsupported> reader::read_map()
+  {
+    auto const start(mark());
+    ++pos;
+
+    runtime::detail::native_persistent_array_map small;
+    runtime::detail::native_transient_hash_map large;
+    bool promoted{};
+    while(true)
+    {
+      auto const key(read_item('}'));
+      if(key.is_err())
+      {
+        return err(unsupported{});
+      }
+      if(key.expect_ok().is_none())
+      {
+        break;
+      }
+
+      /* An odd number of entries is an error, which the parser reports. */
+      auto const value(read_item('}'));
+      if(value.is_err() || value.expect_ok().is_none())
+      {
+        return err(unsupported{});
+      }
+
+      if(promoted)
+      {
+        large.set(key.expect_ok().unwrap(), value.expect_ok().unwrap());
+      }
+      else if(small.size() == runtime::detail::native_persistent_array_map::max_size)
+      {
+        for(auto const &e : small)
+        {
+          large.set(e.first, e.second);
+        }
+        large.set(key.expect_ok().unwrap(), value.expect_ok().unwrap());
+        promoted = true;
+      }
+      else
+      {
+        small.insert_or_assign(key.expect_ok().unwrap(), value.expect_ok().unwrap());
+      }
+    }
+
+    if(promoted)
+    {
+      return ok(make_box<obj::persistent_hash_map>(meta_since(start), large.persistent()).erase());
+    }
+    return ok(make_box<obj::persistent_array_map>(meta_since(start), std::move(small)).erase());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_set()
+  {
+    auto const start(mark());
+    pos += 2;
+
+    runtime::detail::native_transient_hash_set ret;
+    while(true)
+    {
+      auto const item(read_item('}'));
+      if(item.is_err())
+      {
+        return err(unsupported{});
+      }
+      if(item.expect_ok().is_none())
+      {
+        break;
+      }
+      ret.insert(item.expect_ok().unwrap());
+    }
+
+    return ok(
+      make_box<obj::persistent_hash_set>(meta_since(start), std::move(ret).persistent()).erase());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_meta_hint()
+  {
+    ++pos;
+    auto const hint(read_required());
+    if(hint.is_err())
+    {
+      return err(unsupported{});
+    }
+
+    object_ref meta;
+    switch(hint.expect_ok()->type)
+    {
+      case object_type::keyword:
+        meta = obj::persistent_array_map::create_unique(hint.expect_ok(), jank_true);
+        break;
+      case object_type::persistent_array_map:
+      case object_type::persistent_hash_map:
+        meta = hint.expect_ok();
+        break;
+      default:
+        return err(unsupported{});
+    }
+
+    auto const target(read_required());
+    if(target.is_err())
+    {
+      return err(unsupported{});
+    }
+
+    return visit_object(
+      [&](auto const typed_target) -> jtl::result<object_ref, unsupported> {
+        using T = typename decltype(typed_target)::value_type;
+        if constexpr(behavior::metadatable<T>)
+        {
+          if(typed_target->meta.is_none())
+          {
+            return ok(typed_target->with_meta(meta).erase());
+          }
+          return ok(typed_target->with_meta(merge(typed_target->meta.unwrap(), meta)).erase());
+        }
+        else
+        {
+          return err(unsupported{});
+        }
+      },
+      target.expect_ok());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_symbolic_value()
+  {
+    pos += 2;
+    auto const value(read_required());
+    if(value.is_err() || value.expect_ok()->type != object_type::symbol)
+    {
+      return err(unsupported{});
+    }
+
+    auto const &name(expect_object<obj::symbol>(value.expect_ok())->name);
+    if(name == "Inf")
+    {
+      return ok(make_box<obj::real>(std::numeric_limits<f64>::infinity()).erase());
+    }
+    else if(name == "-Inf")
+    {
+      return ok(make_box<obj::real>(-std::numeric_limits<f64>::infinity()).erase());
+    }
+    else if(name == "NaN")
+    {
+      return ok(make_box<obj::real>(std::numeric_limits<f64>::quiet_NaN()).erase());
+    }
+    return err(unsupported{});
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_string()
+  {
+    auto const end(input.data() + input.size());
+    auto const start(++pos);
+    bool escaped{};
+    while(true)
+    {
+      pos += ascii_scan::string(input.data() + pos, end);
+      if(pos == input.size())
+      {
+        return err(unsupported{});
+      }
+
+      auto const c(input[pos]);
+      if(c == '"')
+      {
+        break;
+      }
+      else if(c == '\\')
+      {
+        if(pos + 1 == input.size())
+        {
+          return err(unsupported{});
+        }
+        /* These are the escapes which the lexer allows. */
+        switch(input[pos + 1])
+        {
+          case '"':
+          case '?':
+          case '\'':
+          case '\\':
+          case 'a':
+          case 'b':
+          case 'f':
+          case 'n':
+          case 'r':
+          case 't':
+          case 'v':
+            break;
+          default:
+            return err(unsupported{});
+        }
+        escaped = true;
+        pos += 2;
+      }
+      else
+      {
+        auto const length(utf8_length(input.data() + pos, end));
+        if(length == 0)
+        {
+          return err(unsupported{});
+        }
+        pos += length;
+      }
+    }
+
+    jtl::immutable_string data{ input.data() + start, pos - start };
+    ++pos;
+    require_space = true;
+
+    if(escaped)
+    {
+      auto res(util::unescape(data));
+      if(res.is_err())
+      {
+        return err(unsupported{});
+      }
+      return ok(make_box<obj::persistent_string>(res.expect_ok_move()).erase());
+    }
+    return ok(make_box<obj::persistent_string>(std::move(data)).erase());
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_character()
+  {
+    /* The first character is always part of the literal, even if it would otherwise end it.
+     * Anything which isn't ASCII can't be a valid character literal, so the parser reports
+     * it. */
+    if(pos + 1 == input.size())
+    {
+      return err(unsupported{});
+    }
+    auto const first(static_cast<u8>(input[pos + 1]));
+    if(first <= ' ' || first >= 0x7F)
+    {
+      return err(unsupported{});
+    }
+
+    auto const end(atom_end(pos + 2));
+    if(end < input.size() && static_cast<u8>(input[end]) >= 0x80)
+    {
+      return err(unsupported{});
+    }
+
+    jtl::immutable_string const literal{ input.data() + pos, end - pos };
+    pos = end;
+
+    auto const character(parse::get_char_from_literal(literal));
+    if(character.is_some())
+    {
+      return ok(make_box<obj::character>(character.unwrap()).erase());
+    }
+    if(literal[1] == 'u' || literal[1] == 'o')
+    {
+      auto const bytes(
+        parse::parse_character_in_base(literal.substr(2), literal[1] == 'u' ? 16 : 8));
+      if(bytes.is_ok())
+      {
+        return ok(make_box<obj::character>(bytes.expect_ok()).erase());
+      }
+    }
+    return err(unsupported{});
+  }
+
+  jtl::result<object_ref, unsupported> reader::read_atom()
+  {
+    auto const start(pos);
+    auto const end(atom_end(pos));
+    if(end < input.size() && static_cast<u8>(input[end]) >= 0x80)
+    {
+      return read_lexed_atom(start);
+    }
+    if(end == start)
+    {
+      return err(unsupported{});
+    }
+
+    native_persistent_string_view const s{ input.data() + start, end - start };
+    auto const first(s[0]);
+    if(is_digit(first) || (first == '-' && s.size() > 1 && is_digit(s[1])))
+    {
+      auto const number(read_plain_number(s));
+      if(number.is_none())
+      {
+        return read_lexed_atom(start);
+      }
+      pos = end;
+      require_space = true;
+      return ok(number.unwrap());
+    }
+    else if(first == ':')
+    {
+      pos = end;
+      require_space = true;
+      return make_keyword(s.substr(1));
+    }
+    else if(!is_symbol_start(first))
+    {
+      return read_lexed_atom(start);
+    }
+
+    pos = end;
+    require_space = true;
+    if(s == "nil")
+    {
+      return ok(jank_nil.erase());
+    }
+    else if(s == "true")
+    {
+      return ok(jank_true.erase());
+    }
+    else if(s == "false")
+    {
+      return ok(jank_false.erase());
+    }
+    return make_symbol(s, start);
+  }
+
+  /* Atoms which the fast path doesn't know about, such as those with non-ASCII characters,
+   * radix integers, and ratios, are handed to the lexer one at a time. We still build the
+   * objects ourselves, so they match everything else we read. */
+  jtl::result<object_ref, unsupported> reader::read_lexed_atom(usize const start)
+  {
+    auto end(atom_end(start));
+    while(end < input.size() && static_cast<u8>(input[end]) >= 0x80)
+    {
+      end = atom_end(end + 1);
+    }
+
+    lex::processor l_prc{ native_persistent_string_view{ input.data() + start, end - start } };
+    auto const token_result(l_prc.next());
+    if(token_result.is_err() || token_result.expect_ok().end.offset != end - start)
+    {
+      return err(unsupported{});
+    }
+
+    auto const &token(token_result.expect_ok());
+    pos = end;
+    require_space = true;
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wswitch-enum"
+    switch(token.kind)
+    {
+      case lex::token_kind::nil:
+        return ok(jank_nil.erase());
+      case lex::token_kind::boolean:
+        return ok((std::get<bool>(token.data) ? jank_true : jank_false).erase());
+      case lex::token_kind::integer:
+        return ok(make_box<obj::integer>(std::get<i64>(token.data)).erase());
+      case lex::token_kind::real:
+        return ok(make_box<obj::real>(std::get<f64>(token.data)).erase());
+      case lex::token_kind::ratio:
+        {
+          auto const &ratio_data(std::get<lex::ratio>(token.data));
+          if(ratio_data.denominator == 0)
+          {
+            return err(unsupported{});
+          }
+          return ok(obj::ratio::create(ratio_data.numerator, ratio_data.denominator));
+        }
+      case lex::token_kind::symbol:
+        return make_symbol(std::get<native_persistent_string_view>(token.data), start);
+      case lex::token_kind::keyword:
+        return make_keyword(std::get<native_persistent_string_view>(token.data));
+      default:
+        return err(unsupported{});
+    }
+#pragma clang diagnostic pop
+  }
+
+  /* Symbols have their ns resolved, if it's an alias, just as the parser does for any
+   * unquoted symbol. */
+  jtl::result<object_ref, unsupported>
+  reader::make_symbol(native_persistent_string_view const &s, usize const start)
+  {
+    if(s[0] == '/' && s.size() > 1)
+    {
+      return err(unsupported{});
+    }
+
+    auto const slash(s.find('/'));
+    jtl::immutable_string ns, name;
+    if(slash == native_persistent_string_view::npos || s.size() == 1)
+    {
+      name = s;
+    }
+    else
+    {
+      auto const ns_portion(s.substr(0, slash));
+      auto const resolved_ns(__rt_ctx->resolve_ns(make_box<obj::symbol>(ns_portion)));
+      if(resolved_ns.is_nil())
+      {
+        ns = ns_portion;
+      }
+      else
+      {
+        ns = resolved_ns->name->name;
+      }
+      name = s.substr(slash + 1);
+    }
+
+    if(!source_meta)
+    {
+      return ok(make_box<obj::symbol>(ns, name).erase());
+    }
+    auto const start_position(position_at(start));
+    return ok(
+      make_box<obj::symbol>(source_to_meta(start_position, position_at(start + s.size())),
+                            ns,
+                            name)
+        .erase());
+  }
+
+  /* Takes the keyword without its leading ':'. */
+  jtl::result<object_ref, unsupported>
+  reader::make_keyword(native_persistent_string_view const &s)
+  {
+    if(s.empty() || (s[0] == '/' && s.size() > 1) || (s[0] == ':' && s.size() < 2)
+       || (s[0] == ':' && s[1] == ':'))
+    {
+      return err(unsupported{});
+    }
+
+    /* A :: keyword either resolves to the current ns or an alias, depending on whether or
+     * not it's qualified. */
+    bool const resolved{ s[0] != ':' };
+    auto const slash(s.find('/'));
+    jtl::immutable_string ns, name;
+    if(slash != native_persistent_string_view::npos)
+    {
+      ns = resolved ? s.substr(0, slash) : s.substr(1, slash - 1);
+      name = s.substr(slash + 1);
+    }
+    else
+    {
+      name = s.substr(resolved ? 0 : 1);
+    }
+
+    auto const res(__rt_ctx->intern_keyword(ns, name, resolved));
+    if(res.is_err())
+    {
+      return err(unsupported{});
+    }
+    return ok(res.expect_ok().erase());
+  }
+
+  jtl::result<object_ref, unsupported>
+  read_last(native_persistent_string_view const &input, bool const source_meta)
+  {
+    reader r{ input, source_meta };
+    object_ref ret{ jank_nil };
+    while(true)
+    {
+      auto const form(r.next());
+      if(form.is_err())
+      {
+        return err(unsupported{});
+      }
+      if(form.expect_ok().is_none())
+      {
+        return ok(ret);
+      }
+      ret = form.expect_ok().unwrap();
+    }
+  }
+}
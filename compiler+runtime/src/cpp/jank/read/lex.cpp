@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <iterator>
 
 #include <jank/read/lex.hpp>
+#include <jank/read/ascii_scan.hpp>
 #include <jank/error/lex.hpp>
 #include <jank/runtime/object.hpp>
 #include <jank/runtime/context.hpp>
@@ -282,10 +285,27 @@ namespace jank::read::lex
 
   movable_position &movable_position::operator+=(usize const count)
   {
-    for(usize i{}; i < count; ++i)
+    jank_debug_assert(offset + count <= proc->file.size());
+
+    /* The lexer skips whole runs at once, so this needs to be cheap even for long runs. Only
+     * the newlines matter for the line and column. */
+    auto const begin(proc->file.data() + offset);
+    auto const end(begin + count);
+    auto const newlines(std::count(begin, end, '\n'));
+    if(newlines == 0)
     {
-      ++(*this);
+      col += count;
     }
+    else
+    {
+      line += static_cast<usize>(newlines);
+      auto const last_newline(std::find(std::make_reverse_iterator(end),
+                                        std::make_reverse_iterator(begin),
+                                        '\n'));
+      col = static_cast<usize>(last_newline - std::make_reverse_iterator(end)) + 1;
+    }
+
+    offset += count;
     return *this;
   }
 
@@ -403,8 +423,7 @@ namespace jank::read::lex
 
   static bool is_special_char(char32_t const c)
   {
-    return c == '(' || c == ')' || c == '{' || c == '}' || c == '[' || c == ']' || c == '"'
-      || c == '^' || c == '\\' || c == '`' || c == '~' || c == ',' || c == ';';
+    return ascii_scan::is_special(c);
   }
 
   static bool is_symbol_char(char32_t const c)
@@ -455,10 +474,31 @@ namespace jank::read::lex
     return c >= '0' && c <= '9';
   }
 
+  /* Moves past the run of bytes following the current position, which is the last byte
+   * consumed so far. */
+  template <usize (*Scan)(char const *, char const *)>
+  static void skip_run(movable_position &pos, native_persistent_string_view const file)
+  {
+    if(pos.offset + 1 < file.size())
+    {
+      pos += Scan(file.data() + pos.offset + 1, file.data() + file.size());
+    }
+  }
+
   jtl::result<token, error_ref> processor::next()
   {
     /* Skip whitespace. */
     bool found_space{};
+    if(pos.offset < file.size())
+    {
+      if(auto const spaces(ascii_scan::whitespace(file.data() + pos.offset,
+                                                  file.data() + file.size()));
+         spaces != 0)
+      {
+        found_space = true;
+        pos += spaces;
+      }
+    }
     while(true)
     {
       if(pos.offset >= file.size())
@@ -544,6 +584,10 @@ namespace jank::read::lex
           bool hit_non_semi{};
           while(true)
           {
+            if(hit_non_semi)
+            {
+              skip_run<ascii_scan::comment>(pos, file);
+            }
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -942,6 +986,7 @@ namespace jank::read::lex
           }
           while(true)
           {
+            skip_run<ascii_scan::symbol>(pos, file);
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -1004,6 +1049,7 @@ namespace jank::read::lex
 
           while(true)
           {
+            skip_run<ascii_scan::symbol>(pos, file);
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -1046,6 +1092,10 @@ namespace jank::read::lex
           bool escaped{}, contains_escape{};
           while(true)
           {
+            if(!escaped)
+            {
+              skip_run<ascii_scan::string>(pos, file);
+            }
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -1152,6 +1202,7 @@ namespace jank::read::lex
               {
                 while(true)
                 {
+                  skip_run<ascii_scan::comment>(pos, file);
                   auto const oc(peek());
                   if(oc.is_err())
                   {
@@ -1245,6 +1296,10 @@ namespace jank::read::lex
           pos += oc.expect_ok().len;
           while(pos <= file.size())
           {
+            if(pos.offset < file.size())
+            {
+              pos += ascii_scan::symbol(file.data() + pos.offset, file.data() + file.size());
+            }
             auto const result(convert_to_codepoint(file.substr(pos), pos));
             if(result.is_err())
             {
@@ -365,8 +365,11 @@ namespace jank::read::parse
       .expect_ok();
     util::scope_exit const finally{ [] { __rt_ctx->pop_thread_bindings().expect_ok(); } };
 
-    /* TODO: Only use an array map if everything can fit. */
-    runtime::detail::native_persistent_array_map ret;
+    /* Maps start out as array maps and are promoted to hash maps once they grow past what
+     * an array map holds. The data reader does the same, so both give the same map. */
+    runtime::detail::native_persistent_array_map small;
+    runtime::detail::native_transient_hash_map large;
+    bool promoted{};
     for(auto it(begin()); it != end(); ++it)
     {
       if(it.latest.unwrap().is_err())
@@ -387,7 +390,23 @@ namespace jank::read::parse
       }
       auto const value(it.latest.unwrap().expect_ok());
 
-      ret.insert_or_assign(key.unwrap().ptr, value.unwrap().ptr);
+      if(promoted)
+      {
+        large.set(key.unwrap().ptr, value.unwrap().ptr);
+      }
+      else if(small.size() == runtime::detail::native_persistent_array_map::max_size)
+      {
+        for(auto const &e : small)
+        {
+          large.set(e.first, e.second);
+        }
+        large.set(key.unwrap().ptr, value.unwrap().ptr);
+        promoted = true;
+      }
+      else
+      {
+        small.insert_or_assign(key.unwrap().ptr, value.unwrap().ptr);
+      }
     }
     if(expected_closer.is_some())
     {
@@ -395,9 +414,17 @@ namespace jank::read::parse
     }
 
     expected_closer = prev_expected_closer;
+    if(promoted)
+    {
+      return object_source_info{ make_box<obj::persistent_hash_map>(
+                                   source_to_meta(start_token.start, latest_token.end),
+                                   large.persistent()),
+                                 start_token,
+                                 latest_token };
+    }
     return object_source_info{ make_box<obj::persistent_array_map>(
                                  source_to_meta(start_token.start, latest_token.end),
-                                 std::move(ret)),
+                                 std::move(small)),
                                start_token,
                                latest_token };
   }
@@ -0,0 +1,400 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <jank/read/stream.hpp>
+#include <jank/read/data.hpp>
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::read
+{
+  stream::stream(source_fn &&source)
+    : source{ std::move(source) }
+  {
+  }
+
+  stream::~stream()
+  {
+    close();
+  }
+
+  void stream::close()
+  {
+    if(fd >= 0)
+    {
+      ::close(fd);
+      fd = -1;
+    }
+    exhausted = true;
+    buffer = {};
+  }
+
+  jtl::string_result<stream *> stream::open_file(jtl::immutable_string const &path)
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) */
+    auto const fd(::open(path.c_str(), O_RDONLY));
+    if(fd < 0)
+    {
+      return err(util::format("unable to open file: {}", path));
+    }
+
+    auto const ret(new(GC) stream{ {} });
+    ret->fd = fd;
+    ret->source = [ret](std::string &buffer) -> jtl::string_result<bool> {
+      auto const size(buffer.size());
+      buffer.resize(size + chunk_size);
+      auto const count(::read(ret->fd, buffer.data() + size, chunk_size));
+      if(count < 0)
+      {
+        buffer.resize(size);
+        return err("unable to read file");
+      }
+      buffer.resize(size + static_cast<usize>(count));
+      if(count == 0)
+      {
+        ::close(ret->fd);
+        ret->fd = -1;
+      }
+      return ok(count != 0);
+    };
+    return ok(ret);
+  }
+
+  stream *stream::from_string(jtl::immutable_string const &s)
+  {
+    auto const ret(new(GC) stream{ [](std::string &) -> jtl::string_result<bool> {
+      return ok(false);
+    } });
+    ret->buffer.assign(s.data(), s.size());
+    return ret;
+  }
+
+  stream *stream::from_fn(runtime::object_ref const fn)
+  {
+    auto const ret(new(GC) stream{ {} });
+    ret->chunk_fn = fn;
+    ret->source = [ret](std::string &buffer) -> jtl::string_result<bool> {
+      auto const chunk(runtime::dynamic_call(ret->chunk_fn));
+      if(chunk.is_nil())
+      {
+        return ok(false);
+      }
+      if(chunk->type != runtime::object_type::persistent_string)
+      {
+        return err(
+          util::format("expected a string chunk, found {}", runtime::to_code_string(chunk)));
+      }
+      auto const &data(runtime::expect_object<runtime::obj::persistent_string>(chunk)->data);
+      buffer.append(data.data(), data.size());
+      return ok(true);
+    };
+    return ret;
+  }
+
+  bool stream::complete_form()
+  {
+    return --needed == 0;
+  }
+
+  static bool is_delimiter(char const c)
+  {
+    switch(c)
+    {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\v':
+      case '\f':
+      case '\r':
+      case ',':
+      case '(':
+      case ')':
+      case '[':
+      case ']':
+      case '{':
+      case '}':
+      case '"':
+      case '^':
+      case '\\':
+      case '`':
+      case '~':
+      case ';':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  static jtl::string_result<bool> unsupported(char const * const syntax)
+  {
+    return err(util::format("{} is not supported when reading data", syntax));
+  }
+
+  /* Looks for the end of the next top level form, without lexing it. This only needs to know
+   * about nesting, strings, comments, and the prefixes which apply to a following form. The
+   * form itself is validated when it's parsed. Returns true once the end has been found, in
+   * which case it's stored in form_end. */
+  jtl::string_result<bool> stream::scan()
+  {
+    for(; scanned < buffer.size(); ++scanned)
+    {
+      auto const c(buffer[scanned]);
+      if(in_comment)
+      {
+        in_comment = c != '\n';
+        continue;
+      }
+      if(in_string)
+      {
+        if(in_escape)
+        {
+          in_escape = false;
+        }
+        else if(c == '\\')
+        {
+          in_escape = true;
+        }
+        else if(c == '"')
+        {
+          in_string = false;
+          if(depth == 0 && complete_form())
+          {
+            form_end = scanned + 1;
+            return ok(true);
+          }
+        }
+        continue;
+      }
+      if(in_atom)
+      {
+        if(!is_delimiter(c))
+        {
+          continue;
+        }
+        in_atom = false;
+        if(depth == 0)
+        {
+          if(in_tag)
+          {
+            in_tag = false;
+          }
+          else if(complete_form())
+          {
+            form_end = scanned;
+            return ok(true);
+          }
+        }
+      }
+
+      /* Some tokens can only be told apart by the byte after them. */
+      auto const has_next(scanned + 1 < buffer.size());
+      if((c == '\\' || c == '#') && !has_next && !exhausted)
+      {
+        return ok(false);
+      }
+      auto const next(has_next ? buffer[scanned + 1] : ' ');
+
+      switch(c)
+      {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\v':
+        case '\f':
+        case '\r':
+        case ',':
+          break;
+        case ';':
+          in_comment = true;
+          break;
+        case '"':
+          in_string = true;
+          break;
+        case '(':
+        case '[':
+        case '{':
+          ++depth;
+          break;
+        case ')':
+        case ']':
+        case '}':
+          /* An unmatched closer is its own form, so the parser can report it. */
+          if(depth == 0 || (--depth == 0 && complete_form()))
+          {
+            form_end = scanned + 1;
+            return ok(true);
+          }
+          break;
+        case '\\':
+          /* A character literal's first character is always part of it, even if it would
+           * otherwise be a delimiter. */
+          scanned += has_next ? 1 : 0;
+          in_atom = true;
+          break;
+        case '^':
+          if(depth == 0)
+          {
+            ++needed;
+          }
+          break;
+        case '\'':
+          return unsupported("Quoting");
+        case '`':
+          return unsupported("Syntax quoting");
+        case '~':
+          return unsupported("Unquoting");
+        case '@':
+          return unsupported("Dereferencing");
+        case '#':
+          switch(next)
+          {
+            case '_':
+              ++scanned;
+              if(depth == 0)
+              {
+                ++needed;
+              }
+              break;
+            case '!':
+              ++scanned;
+              in_comment = true;
+              break;
+            case '#':
+              ++scanned;
+              in_atom = true;
+              break;
+            case '{':
+            case '"':
+              break;
+            case '(':
+              return unsupported("An anonymous fn");
+            case '\'':
+              return unsupported("A var quote");
+            case '?':
+              return unsupported("A reader conditional");
+            case '=':
+              return unsupported("Read time evaluation");
+            default:
+              /* A tag, such as #inst, or a namespaced map's prefix. Either way, it belongs to
+               * the form after it. */
+              in_atom = true;
+              in_tag = depth == 0;
+              break;
+          }
+          break;
+        default:
+          in_atom = true;
+          break;
+      }
+    }
+
+    /* Whatever is left at the end of the input is the last form, or an incomplete one,
+     * which the parser will report. */
+    if(exhausted)
+    {
+      form_end = buffer.size();
+      return ok(true);
+    }
+    return ok(false);
+  }
+
+  jtl::string_result<jtl::option<runtime::object_ref>> stream::parse(usize const end)
+  {
+    /* Like read_string, this isn't reading from a file, so source info shouldn't point at
+     * whichever file was last being read. */
+    runtime::context::binding_scope const preserve{
+      *runtime::__rt_ctx,
+      runtime::obj::persistent_hash_map::create_unique(
+        std::make_pair(runtime::__rt_ctx->current_file_var, runtime::jank_nil.erase()))
+    };
+
+    native_persistent_string_view const text{ buffer.data() + consumed, end - consumed };
+
+    /* The data reader handles any valid data. The parser is only needed to report errors. */
+    data::reader d_reader{ text, source_meta };
+    auto const res(d_reader.next());
+    if(res.is_ok())
+    {
+      return ok(res.expect_ok());
+    }
+
+    lex::processor l_prc{ text };
+    parse::processor p_prc{ l_prc.begin(), l_prc.end() };
+
+    jtl::option<runtime::object_ref> ret;
+    for(auto const &form : p_prc)
+    {
+      if(form.is_err())
+      {
+        return err(form.expect_err()->message);
+      }
+      if(ret.is_none())
+      {
+        ret = some(form.expect_ok().unwrap().ptr);
+      }
+    }
+    return ok(ret);
+  }
+
+  jtl::string_result<jtl::option<runtime::object_ref>> stream::next()
+  {
+    while(true)
+    {
+      auto const found(scan());
+      if(found.is_err())
+      {
+        /* There's no telling where the rest of this form is, so we can't carry on. */
+        buffer.clear();
+        consumed = scanned = 0;
+        exhausted = true;
+        return err(found.expect_err());
+      }
+
+      if(found.expect_ok())
+      {
+        auto const end(form_end);
+        util::scope_exit const advance{ [&] {
+          consumed = scanned = end;
+          depth = 0;
+          needed = 1;
+          in_string = in_escape = in_comment = in_atom = in_tag = false;
+        } };
+
+        if(consumed == end)
+        {
+          return ok(none);
+        }
+
+        auto res(parse(end));
+        if(res.is_err() || res.expect_ok().is_some())
+        {
+          return res;
+        }
+        /* The form was discarded with #_, so there's nothing to return yet. */
+        continue;
+      }
+
+      /* Drop what we've already read before pulling in more, so the buffer only ever holds
+       * the current form plus the latest chunk. */
+      buffer.erase(0, consumed);
+      scanned -= consumed;
+      consumed = 0;
+
+      auto const more(source(buffer));
+      if(more.is_err())
+      {
+        exhausted = true;
+        return err(more.expect_err());
+      }
+      exhausted = !more.expect_ok();
+    }
+  }
+}
@@ -76,7 +76,8 @@ namespace jank::runtime
                           || std::same_as<T, obj::persistent_array_map>
                           || std::same_as<T, obj::transient_vector>
                           || std::same_as<T, obj::transient_hash_set>
-                          || std::same_as<T, obj::keyword>)
+                          || std::same_as<T, obj::keyword>
+                          || std::same_as<T, obj::promise>)
         {
           return typed_source->call(a1);
         }
@@ -1,4 +1,5 @@
 #include <exception>
+#include <utility>
 
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
@@ -9,6 +10,7 @@
 
 #include <jank/read/lex.hpp>
 #include <jank/read/parse.hpp>
+#include <jank/read/data.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core.hpp>
@@ -16,20 +18,19 @@
 #include <jank/runtime/core/meta.hpp>
 #include <jank/analyze/processor.hpp>
 #include <jank/analyze/expr/primitive_literal.hpp>
+#include <jank/analyze/rtti.hpp>
 #include <jank/evaluate.hpp>
 #include <jank/jit/processor.hpp>
 #include <jank/util/process_location.hpp>
 #include <jank/util/clang_format.hpp>
 #include <jank/util/dir.hpp>
 #include <jank/util/fmt/print.hpp>
+#include <jank/util/scope_exit.hpp>
 #include <jank/codegen/llvm_processor.hpp>
 #include <jank/profile/time.hpp>
 
 namespace jank::runtime
 {
-  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
-  thread_local decltype(context::thread_binding_frames) context::thread_binding_frames{};
-
   /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
   context *__rt_ctx{};
 
@@ -44,6 +45,8 @@ namespace jank::runtime
                                                opts.include_dirs,
                                                opts.define_macros) }
     , module_loader{ *this, opts.module_path }
+    , interpreter_enabled{ opts.interpreter_enabled }
+    , interpreter_jit_threshold{ opts.interpreter_jit_threshold }
   {
     auto const core(intern_ns(make_box<obj::symbol>("clojure.core")));
 
@@ -72,6 +75,11 @@ namespace jank::runtime
     assert_var->bind_root(jank_true);
     assert_var->dynamic.store(true);
 
+    auto const agent_sym(make_box<obj::symbol>("*agent*"));
+    agent_var = core->intern_var(agent_sym);
+    agent_var->bind_root(jank_nil);
+    agent_var->dynamic.store(true);
+
     /* These are not actually interned. They're extra private. */
     current_module_var
       = make_box<runtime::var>(core, make_box<obj::symbol>("*current-module*"))->set_dynamic(true);
@@ -94,7 +102,11 @@ namespace jank::runtime
 
   context::~context()
   {
-    thread_binding_frames.erase(this);
+    auto &stack(thread_binding_stack::current());
+    while(!stack.frames.empty() && stack.frames.back().rt_ctx == this)
+    {
+      stack.pop(this).expect_ok();
+    }
   }
 
   obj::symbol_ref context::qualify_symbol(obj::symbol_ref const &sym) const
@@ -110,7 +122,7 @@ namespace jank::runtime
 
   var_ref context::find_var(obj::symbol_ref const &sym)
   {
-    profile::timer const timer{ "rt find_var" };
+    profile::timer const timer{ profile::region<"rt find_var"> };
     if(!sym->ns.empty())
     {
       ns_ref ns{};
@@ -160,21 +172,96 @@ namespace jank::runtime
     return eval_string(file.expect_ok().view());
   }
 
+  /* Set by eval_string while it has defs batched up and not yet evaluated. Macros from the
+   * current ns may call into those defs, so this is called before expanding one. It's per
+   * thread, since a future or agent evaluating code must never flush another thread's
+   * batch. */
+  static thread_local std::function<void()> const *flush_batched_defs{};
+
+  /* A def can be evaluated later, along with its neighbors, so long as analyzing the
+   * following forms doesn't depend on its value. We know that's the case for fns and
+   * literals. Macros need to be callable right away, so they end a batch. */
+  enum class batch_kind : u8
+  {
+    none,
+    batch,
+    batch_and_flush
+  };
+
+  static batch_kind batch_kind_of(analyze::expression_ref const expr)
+  {
+    auto const def(llvm::dyn_cast<analyze::expr::def>(expr.data));
+    if(!def)
+    {
+      return batch_kind::none;
+    }
+
+    if(def->value.is_some())
+    {
+      auto const kind(def->value.unwrap()->kind);
+      if(kind != analyze::expression_kind::function
+         && kind != analyze::expression_kind::primitive_literal)
+      {
+        return batch_kind::none;
+      }
+    }
+
+    auto const macro(get(def->name->meta.unwrap_or(jank_nil),
+                         __rt_ctx->intern_keyword("", "macro", true).expect_ok()));
+    return truthy(macro) ? batch_kind::batch_and_flush : batch_kind::batch;
+  }
+
   object_ref context::eval_string(native_persistent_string_view const &code)
   {
-    profile::timer const timer{ "rt eval_string" };
+    profile::timer const timer{ profile::region<"rt eval_string"> };
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ l_prc.begin(), l_prc.end() };
 
     object_ref ret{ jank_nil };
     native_vector<analyze::expression_ref> exprs{};
+
+    /* Rather than JIT compiling a module for each form, consecutive defs are gathered up
+     * and compiled as one module. Anything else flushes the batch before being evaluated,
+     * since it may have side effects which later analysis relies upon. Expanding a macro
+     * from this ns flushes it too, since the macro may call one of the batched fns. The
+     * interpreter doesn't JIT compile each form, so there's nothing to gain from batching
+     * there. */
+    native_vector<analyze::expression_ref> batch{};
+    auto const flush_batch([&] {
+      if(!batch.empty())
+      {
+        ret = evaluate::eval_batch(batch, an_prc);
+        batch.clear();
+      }
+    });
+    std::function<void()> const flush{ flush_batch };
+    auto const prev_flush_batched_defs(std::exchange(flush_batched_defs, &flush));
+    util::scope_exit const finally{ [&]() { flush_batched_defs = prev_flush_batched_defs; } };
+
     for(auto const &form : p_prc)
     {
       auto const expr(
         an_prc.analyze(form.expect_ok().unwrap().ptr, analyze::expression_position::statement));
-      ret = evaluate::eval(expr.expect_ok());
+      auto const batching(interpreter_enabled ? batch_kind::none : batch_kind_of(expr.expect_ok()));
+      if(batching == batch_kind::none)
+      {
+        flush_batch();
+        ret = evaluate::eval(expr.expect_ok());
+      }
+      else
+      {
+        /* The var and its meta are needed right away, since later analysis looks at
+         * them for macros, dynamic vars, and unboxed arities. */
+        evaluate::intern_def(static_ref_cast<analyze::expr::def>(expr.expect_ok()));
+        batch.emplace_back(expr.expect_ok());
+        if(batching == batch_kind::batch_and_flush)
+        {
+          flush_batch();
+        }
+      }
       exprs.emplace_back(expr.expect_ok());
     }
+    flush_batch();
 
     if(truthy(compile_files_var->deref()))
     {
@@ -194,6 +281,7 @@ namespace jank::runtime
       fn->unique_name = fn->name;
       codegen::llvm_processor cg_prc{ wrapped_exprs, module, codegen::compilation_target::module };
       cg_prc.gen().expect_ok();
+      cg_prc.optimize();
       write_module(cg_prc.ctx->module_name, cg_prc.ctx->module).expect_ok();
     }
 
@@ -202,10 +290,11 @@ namespace jank::runtime
 
   void context::eval_cpp_string(native_persistent_string_view const &code) const
   {
-    profile::timer const timer{ "rt eval_cpp_string" };
+    profile::timer const timer{ profile::region<"rt eval_cpp_string"> };
 
     /* TODO: Handle all the errors here to avoid exceptions. Also, return a message that
      * is valuable to the user. */
+    std::lock_guard<std::recursive_mutex> const lock{ jit_prc.compile_mutex };
     auto &partial_tu{ jit_prc.interpreter->Parse({ code.data(), code.size() }).get() };
 
     /* Writing the module before executing it because `llvm::Interpreter::Execute`
@@ -221,7 +310,7 @@ namespace jank::runtime
 
   object_ref context::read_string(native_persistent_string_view const &code)
   {
-    profile::timer const timer{ "rt read_string" };
+    profile::timer const timer{ profile::region<"rt read_string"> };
 
     /* When reading an arbitrary string, we don't want the last *current-file* to
      * be set as source file, so we need to bind it to nil. */
@@ -229,6 +318,14 @@ namespace jank::runtime
                                   obj::persistent_hash_map::create_unique(
                                     std::make_pair(current_file_var, jank_nil)) };
 
+    /* Most strings which are read at runtime are data, which doesn't need the full parser.
+     * Anything else is read again, from the start, by the parser. */
+    auto const data(read::data::read_last(code, true));
+    if(data.is_ok())
+    {
+      return data.expect_ok();
+    }
+
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ l_prc.begin(), l_prc.end() };
 
@@ -244,7 +341,7 @@ namespace jank::runtime
   native_vector<analyze::expression_ref>
   context::analyze_string(native_persistent_string_view const &code, bool const eval)
   {
-    profile::timer const timer{ "rt analyze_string" };
+    profile::timer const timer{ profile::region<"rt analyze_string"> };
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ l_prc.begin(), l_prc.end() };
 
@@ -320,7 +417,9 @@ namespace jank::runtime
   jtl::string_result<void> context::write_module(jtl::immutable_string const &module_name,
                                                  std::unique_ptr<llvm::Module> const &module) const
   {
-    profile::timer const timer{ util::format("write_module {}", module_name) };
+    profile::timer const timer{ [&] {
+      return util::format("write_module {}", module_name);
+    } };
     std::filesystem::path const module_path{
       util::format("{}/{}.o", binary_cache_dir, module::module_to_path(module_name))
     };
@@ -462,7 +561,7 @@ namespace jank::runtime
   jtl::result<var_ref, jtl::immutable_string>
   context::intern_var(obj::symbol_ref const &qualified_sym)
   {
-    profile::timer const timer{ "intern_var" };
+    profile::timer const timer{ profile::region<"intern_var"> };
     if(qualified_sym->ns.empty())
     {
       return err(
@@ -503,29 +602,24 @@ namespace jank::runtime
         resolved_ns = current_ns->name->name;
       }
     }
-    return intern_keyword(resolved_ns.empty() ? name : util::format("{}/{}", resolved_ns, name));
+    return keywords.intern(resolved_ns, name);
   }
 
   jtl::result<obj::keyword_ref, jtl::immutable_string>
   context::intern_keyword(jtl::immutable_string const &s)
   {
-    profile::timer const timer{ "rt intern_keyword" };
-
-    auto locked_keywords(keywords.wlock());
-    auto const found(locked_keywords->find(s));
-    if(found != locked_keywords->end())
+    /* This splits the same way symbols do. */
+    auto const found(s.find('/'));
+    if(found != jtl::immutable_string::npos && s.size() > 1)
     {
-      return found->second;
+      return keywords.intern(s.substr(0, found), s.substr(found + 1));
     }
-
-    auto const res(
-      locked_keywords->emplace(s, make_box<obj::keyword>(detail::must_be_interned{}, s)));
-    return res.first->second;
+    return keywords.intern("", s);
   }
 
   object_ref context::macroexpand1(object_ref const o)
   {
-    profile::timer const timer{ "rt macroexpand1" };
+    profile::timer const timer{ profile::region<"rt macroexpand1"> };
     return visit_seqable(
       [this](auto const typed_o) -> object_ref {
         using T = typename decltype(typed_o)::value_type;
@@ -556,6 +650,11 @@ namespace jank::runtime
             return typed_o;
           }
 
+          if(flush_batched_defs && var->n == current_ns())
+          {
+            (*flush_batched_defs)();
+          }
+
           /* TODO: Provide &env. */
           auto const args(cons(cons(rest(typed_o), jank_nil), typed_o));
           return apply_to(var->deref(), args);
@@ -614,19 +713,13 @@ namespace jank::runtime
 
   jtl::string_result<void> context::push_thread_bindings()
   {
-    auto bindings(obj::persistent_hash_map::empty());
-    auto &tbfs(thread_binding_frames[this]);
-    if(!tbfs.empty())
-    {
-      bindings = tbfs.front().bindings;
-    }
     /* Nothing to preserve, if there are no current bindings. */
-    else
+    if(thread_binding_stack::current().frames.empty())
     {
       return ok();
     }
 
-    return push_thread_bindings(bindings);
+    return push_thread_bindings(get_thread_bindings());
   }
 
   jtl::string_result<void> context::push_thread_bindings(object_ref const bindings)
@@ -643,77 +736,21 @@ namespace jank::runtime
   jtl::string_result<void>
   context::push_thread_bindings(obj::persistent_hash_map_ref const bindings)
   {
-    thread_binding_frame frame{ obj::persistent_hash_map::empty() };
-    auto &tbfs(thread_binding_frames[this]);
-    if(!tbfs.empty())
-    {
-      frame.bindings = tbfs.front().bindings;
-    }
-
-    auto const thread_id(std::this_thread::get_id());
-
-    for(auto it(bindings->fresh_seq()); it.is_some(); it = it->next_in_place())
-    {
-      auto const entry(it->first());
-      auto const var(expect_object<var>(entry->data[0]));
-      if(!var->dynamic.load())
-      {
-        return err(util::format("Can't dynamically bind non-dynamic var: {}", var->to_string()));
-      }
-
-      /* XXX: Once this is set to true, here, it's never unset. */
-      var->thread_bound.store(true);
-
-      /* The binding may already be a thread binding if we're just pushing the previous
-       * bindings again to give a scratch pad for some upcoming code. */
-      if(entry->data[1]->type == object_type::var_thread_binding)
-      {
-        frame.bindings = frame.bindings->assoc(
-          var,
-          make_box<var_thread_binding>(expect_object<var_thread_binding>(entry->data[1])->value,
-                                       thread_id));
-      }
-      else
-      {
-        frame.bindings
-          = frame.bindings->assoc(var, make_box<var_thread_binding>(entry->data[1], thread_id));
-      }
-    }
-
-    tbfs.push_front(std::move(frame));
-    return ok();
+    return thread_binding_stack::current().push(this, bindings);
   }
 
   jtl::string_result<void> context::pop_thread_bindings()
   {
-    auto &tbfs(thread_binding_frames[this]);
-    if(tbfs.empty())
-    {
-      return err("Mismatched thread binding pop");
-    }
-
-    tbfs.pop_front();
-
-    return ok();
+    return thread_binding_stack::current().pop(this);
   }
 
   obj::persistent_hash_map_ref context::get_thread_bindings() const
   {
-    auto const &tbfs(thread_binding_frames[this]);
-    if(tbfs.empty())
+    auto const &stack(thread_binding_stack::current());
+    if(stack.frames.empty())
     {
       return obj::persistent_hash_map::empty();
     }
-    return tbfs.front().bindings;
-  }
-
-  jtl::option<thread_binding_frame> context::current_thread_binding_frame()
-  {
-    auto &tbfs(thread_binding_frames[this]);
-    if(tbfs.empty())
-    {
-      return none;
-    }
-    return tbfs.front();
+    return stack.to_map();
   }
 }
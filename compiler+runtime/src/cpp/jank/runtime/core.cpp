@@ -2,6 +2,7 @@
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/behavior/nameable.hpp>
 #include <jank/runtime/behavior/derefable.hpp>
+#include <jank/runtime/behavior/pending.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/sequence_range.hpp>
 #include <jank/util/fmt.hpp>
@@ -468,6 +469,44 @@ namespace jank::runtime
     return o;
   }
 
+  object_ref
+  blocking_deref(object_ref const o, object_ref const timeout_ms, object_ref const timeout_val)
+  {
+    return visit_object(
+      [=](auto const typed_o) -> object_ref {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(behavior::blocking_derefable<T>)
+        {
+          return typed_o->deref(timeout_ms, timeout_val);
+        }
+        else
+        {
+          throw std::runtime_error{ util::format("not blocking derefable: {}",
+                                                 typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  bool is_realized(object_ref const o)
+  {
+    return visit_object(
+      [=](auto const typed_o) -> bool {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(behavior::pending<T>)
+        {
+          return typed_o->is_realized();
+        }
+        else
+        {
+          throw std::runtime_error{ util::format("not pending: {}", typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
   object_ref tagged_literal(object_ref const tag, object_ref const form)
   {
     return make_box<obj::tagged_literal>(tag, form);
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <immer/algorithm.hpp>
+
+#include <jank/runtime/core/fold.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/reduced.hpp>
+#include <jank/runtime/work_pool.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime
+{
+  struct fold_state
+  {
+    usize n{};
+    object_ref combinef;
+    object_ref reducef;
+    work_pool &pool;
+  };
+
+  /* One half of a split, which may be run by any thread in the pool. The joining thread
+   * keeps this on its stack, so the GC can see the result. */
+  struct fold_fork
+  {
+    object_ref result;
+    object_ref error;
+    bool failed{};
+    std::atomic<bool> done{};
+  };
+
+  template <typename F>
+  static void run_fork(fold_fork &fork, F const &f)
+  {
+    try
+    {
+      fork.result = f();
+    }
+    catch(std::exception const &e)
+    {
+      fork.error = make_box(e.what());
+      fork.failed = true;
+    }
+    catch(object_ref const e)
+    {
+      fork.error = e;
+      fork.failed = true;
+    }
+    catch(...)
+    {
+      fork.error = make_box("unknown exception in fold");
+      fork.failed = true;
+    }
+    fork.done.store(true, std::memory_order_release);
+  }
+
+  /* Rather than block, the joining thread runs queued work, which is most likely the very
+   * fork it's waiting on. */
+  static void join(work_pool &pool, fold_fork const &fork)
+  {
+    while(!fork.done.load(std::memory_order_acquire))
+    {
+      if(!pool.help())
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /* Splits [start, end) in half until a piece holds at most n elements. The left half is
+   * forked onto the pool and the right half is folded on this thread. */
+  template <typename Size, typename Leaf>
+  static object_ref fold_range(fold_state const &state,
+                               usize const start,
+                               usize const end,
+                               Size const &size,
+                               Leaf const &leaf)
+  {
+    if(end - start <= 1 || size(start, end) <= state.n)
+    {
+      return leaf(start, end);
+    }
+
+    auto const mid(start + (end - start) / 2);
+    fold_fork left;
+    state.pool.submit([&state, &left, &size, &leaf, start, mid] {
+      run_fork(left, [&] { return fold_range(state, start, mid, size, leaf); });
+    });
+
+    object_ref right;
+    try
+    {
+      right = fold_range(state, mid, end, size, leaf);
+    }
+    catch(...)
+    {
+      /* The fork refers to our stack, so it needs to finish before we unwind. */
+      join(state.pool, left);
+      throw;
+    }
+
+    join(state.pool, left);
+    if(left.failed)
+    {
+      throw left.error;
+    }
+    return dynamic_call(state.combinef, left.result, right);
+  }
+
+  static bool unwrap_reduced(object_ref &res)
+  {
+    if(res->type == object_type::reduced)
+    {
+      res = expect_object<obj::reduced>(res)->val;
+      return true;
+    }
+    return false;
+  }
+
+  /* Vectors are split by index. Each piece walks the vector's leaf arrays directly. */
+  static object_ref fold_vector(fold_state const &state, obj::persistent_vector_ref const v)
+  {
+    auto const &data(v->data);
+    return fold_range(
+      state,
+      0,
+      data.size(),
+      [](usize const start, usize const end) { return end - start; },
+      [&](usize const start, usize const end) {
+        object_ref res{ dynamic_call(state.combinef) };
+        immer::for_each_chunk_p(data.begin() + start,
+                                data.begin() + end,
+                                [&](auto const first, auto const last) {
+                                  for(auto it(first); it != last; ++it)
+                                  {
+                                    res = dynamic_call(state.reducef, res, *it);
+                                    if(unwrap_reduced(res))
+                                    {
+                                      return false;
+                                    }
+                                  }
+                                  return true;
+                                });
+        return res;
+      });
+  }
+
+  /* Hash maps are split along their leaves. Gathering the leaves is one walk over the
+   * trie's nodes, without touching any entries, and then the leaves are folded like a
+   * vector, weighted by how many entries each holds. */
+  static object_ref fold_map(fold_state const &state, obj::persistent_hash_map_ref const m)
+  {
+    using entry = runtime::detail::native_persistent_hash_map::value_type;
+
+    native_vector<std::pair<entry const *, entry const *>> leaves;
+    /* The number of entries before each leaf, with the total at the end. */
+    native_vector<usize> offsets{ 0 };
+    immer::for_each_chunk(m->data, [&](auto const first, auto const last) {
+      leaves.emplace_back(first, last);
+      offsets.emplace_back(offsets.back() + static_cast<usize>(last - first));
+    });
+
+    return fold_range(
+      state,
+      0,
+      leaves.size(),
+      [&](usize const start, usize const end) { return offsets[end] - offsets[start]; },
+      [&](usize const start, usize const end) {
+        object_ref res{ dynamic_call(state.combinef) };
+        for(auto leaf(start); leaf != end; ++leaf)
+        {
+          for(auto it(leaves[leaf].first); it != leaves[leaf].second; ++it)
+          {
+            res = dynamic_call(state.reducef, res, it->first, it->second);
+            if(unwrap_reduced(res))
+            {
+              return res;
+            }
+          }
+        }
+        return res;
+      });
+  }
+
+  bool is_foldable(object_ref const o)
+  {
+    return o->type == object_type::persistent_vector
+      || o->type == object_type::persistent_hash_map;
+  }
+
+  object_ref
+  fold(object_ref const n, object_ref const combinef, object_ref const reducef, object_ref const coll)
+  {
+    fold_state const state{ static_cast<usize>(std::max<i64>(to_int(n), 1)),
+                            combinef,
+                            reducef,
+                            work_pool::global() };
+
+    switch(coll->type)
+    {
+      case object_type::persistent_vector:
+        return fold_vector(state, expect_object<obj::persistent_vector>(coll));
+      case object_type::persistent_hash_map:
+        return fold_map(state, expect_object<obj::persistent_hash_map>(coll));
+      default:
+        throw std::runtime_error{ util::format("not foldable: {}", runtime::to_string(coll)) };
+    }
+  }
+}
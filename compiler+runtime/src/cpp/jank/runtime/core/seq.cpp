@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <random>
 
+#include <immer/algorithm.hpp>
+
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/behavior/associatively_readable.hpp>
 #include <jank/runtime/behavior/associatively_writable.hpp>
@@ -1054,21 +1056,60 @@ namespace jank::runtime
       r);
   }
 
+  /* Walks the vector's leaves directly, from the given index, rather than going through
+   * the sequence protocol one element at a time. */
+  static object_ref reduce_vector(object_ref const f,
+                                  object_ref const init,
+                                  obj::persistent_vector_ref const v,
+                                  usize const start)
+  {
+    object_ref res{ init };
+    immer::for_each_chunk_p(
+      v->data.begin() + static_cast<decltype(obj::persistent_vector::data)::difference_type>(start),
+      v->data.end(),
+      [&](auto const first, auto const last) {
+        for(auto it(first); it != last; ++it)
+        {
+          res = dynamic_call(f, res, *it);
+          if(res->type == object_type::reduced)
+          {
+            res = expect_object<obj::reduced>(res)->val;
+            return false;
+          }
+        }
+        return true;
+      });
+    return res;
+  }
+
   object_ref reduce(object_ref const f, object_ref const init, object_ref const s)
   {
     return visit_seqable(
       [](auto const typed_coll, object_ref const f, object_ref const init) -> object_ref {
-        object_ref res{ init };
-        for(auto const e : make_sequence_range(typed_coll))
+        using T = typename decltype(typed_coll)::value_type;
+
+        if constexpr(std::same_as<T, obj::persistent_vector>)
         {
-          res = dynamic_call(f, res, e);
-          if(res->type == object_type::reduced)
+          return reduce_vector(f, init, typed_coll, 0);
+        }
+        else if constexpr(std::same_as<T, obj::persistent_vector_sequence>)
+        {
+          return reduce_vector(f, init, typed_coll->vec, typed_coll->index);
+        }
+        else
+        {
+          object_ref res{ init };
+          for(auto const e : make_sequence_range(typed_coll))
           {
-            res = expect_object<obj::reduced>(res)->val;
-            break;
+            res = dynamic_call(f, res, e);
+            if(res->type == object_type::reduced)
+            {
+              res = expect_object<obj::reduced>(res)->val;
+              break;
+            }
           }
+          return res;
         }
-        return res;
       },
       s,
       f,
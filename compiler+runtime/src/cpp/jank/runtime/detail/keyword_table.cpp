@@ -0,0 +1,41 @@
+#include <mutex>
+#include <shared_mutex>
+
+#include <jank/runtime/detail/keyword_table.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+namespace jank::runtime::detail
+{
+  bool keyword_table::key::operator==(key const &rhs) const
+  {
+    return hash == rhs.hash && name == rhs.name && ns == rhs.ns;
+  }
+
+  obj::keyword_ref
+  keyword_table::intern(jtl::immutable_string const &ns, jtl::immutable_string const &name)
+  {
+    key const k{ ns, name, hash::combine(ns.to_hash(), name.to_hash()) };
+    auto &s(shards[k.hash % shard_count]);
+
+    {
+      std::shared_lock const lock{ s.mutex };
+      auto const found(s.keywords.find(k));
+      if(found != s.keywords.end())
+      {
+        return found->second;
+      }
+    }
+
+    /* Someone else may have interned it between our locks, so look again before boxing a new
+     * keyword. This way, racing threads don't each allocate a box just to throw all but one away. */
+    std::unique_lock const lock{ s.mutex };
+    auto const found(s.keywords.find(k));
+    if(found != s.keywords.end())
+    {
+      return found->second;
+    }
+
+    auto const res(s.keywords.emplace(k, make_box<obj::keyword>(must_be_interned{}, ns, name)));
+    return res.first->second;
+  }
+}
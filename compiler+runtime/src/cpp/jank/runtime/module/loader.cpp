@@ -659,7 +659,7 @@ namespace jank::runtime::module
   jtl::string_result<void>
   loader::load_o(jtl::immutable_string const &module, file_entry const &entry) const
   {
-    profile::timer const timer{ util::format("load object {}", module) };
+    profile::timer const timer{ [&] { return util::format("load object {}", module); } };
 
     /* While loading an object, if the main ns loading symbol exists, then
      * we don't need to load the object file again.
@@ -0,0 +1,429 @@
+#include <thread>
+
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/cons.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/var.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/work_pool.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::runtime::obj
+{
+  /* How many actions one drain runs before giving its thread back to the executor. This
+   * amortizes scheduling across many sends, without letting a busy agent hog a worker. */
+  static constexpr usize batch_size{ 64 };
+
+  /* The agent whose action is running on this thread, if any. */
+  static thread_local agent *current_agent{};
+  /* The action which is running on this thread, if any, and how many binding frames this
+   * thread had once the action's bindings were pushed. */
+  static thread_local agent::action const *current_action{};
+  static thread_local usize current_action_frames{};
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<bool> shut_down{};
+
+  static bool is_keyword(object_ref const o, char const * const name)
+  {
+    return o->type == object_type::keyword && expect_object<keyword>(o)->get_namespace().empty()
+      && expect_object<keyword>(o)->get_name() == name;
+  }
+
+  static void schedule(agent * const a, object_ref const executor)
+  {
+    if(is_keyword(executor, "send"))
+    {
+      work_pool::global().submit(
+        [a] { a->drain(__rt_ctx->intern_keyword("send").expect_ok()); });
+    }
+    else if(is_keyword(executor, "send-off"))
+    {
+      /* send-off actions may block, so they don't run on the fixed size work pool. */
+      growing_pool::global().submit(
+        [a] { a->drain(__rt_ctx->intern_keyword("send-off").expect_ok()); });
+    }
+    else
+    {
+      dynamic_call(executor,
+                   make_box<native_function_wrapper>(std::function<object_ref()>{ [a, executor] {
+                     a->drain(executor);
+                     return object_ref{};
+                   } }));
+    }
+  }
+
+  /* Only the single consumer may call this. Producers link their node in just after
+   * swapping the head, so a counted node may briefly not be reachable yet. */
+  static agent::action *next_action(agent::action const * const tail)
+  {
+    auto next(tail->next.load(std::memory_order_acquire));
+    while(!next)
+    {
+      std::this_thread::yield();
+      next = tail->next.load(std::memory_order_acquire);
+    }
+    return next;
+  }
+
+  static void validate(object_ref const validator, object_ref const state)
+  {
+    if(validator.is_some() && !truthy(dynamic_call(validator, state)))
+    {
+      throw std::runtime_error{ "invalid reference state" };
+    }
+  }
+
+  static void enqueue(agent * const a, agent::action * const act)
+  {
+    auto const prev(a->head.exchange(act, std::memory_order_acq_rel));
+    prev->next.store(act, std::memory_order_release);
+    if(a->queued.fetch_add(1, std::memory_order_acq_rel) == 0)
+    {
+      schedule(a, act->executor);
+    }
+  }
+
+  /* Continues draining on the executor of the next queued action. Only the consumer may
+   * call this, and only when there's at least one queued action. */
+  static void resume(agent * const a)
+  {
+    schedule(a, next_action(a->tail)->executor);
+  }
+
+  static bool is_failed(agent const * const a)
+  {
+    return object_ref{ a->error.load() }.is_some();
+  }
+
+  /* A failed agent keeps its queue, but stops draining it until it's restarted. */
+  static void park(agent * const a)
+  {
+    a->parked.store(true);
+    /* If a restart happened after we saw the failure, it won't have seen us parked, so we
+     * pick the queue back up ourselves. */
+    if(!is_failed(a) && a->parked.exchange(false))
+    {
+      resume(a);
+    }
+  }
+
+  agent::agent(object_ref const state)
+    : state{ state.data }
+    , validator{ object_ref{}.data }
+    , error_handler{ object_ref{}.data }
+    , error{ object_ref{}.data }
+    , head{ new action{} }
+    , tail{ head.load() }
+  {
+  }
+
+  bool agent::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  jtl::immutable_string agent::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void agent::to_string(util::string_builder &buff) const
+  {
+    util::format_to(buff, "{}@{}", object_type_str(base.type), &base);
+  }
+
+  jtl::immutable_string agent::to_code_string() const
+  {
+    return to_string();
+  }
+
+  uhash agent::to_hash() const
+  {
+    return static_cast<uhash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ref agent::deref() const
+  {
+    return state.load();
+  }
+
+  agent_ref agent::dispatch(object_ref const executor, object_ref const fn, object_ref const args)
+  {
+    if(shut_down.load())
+    {
+      throw std::runtime_error{ "agents have been shut down" };
+    }
+    if(is_failed(this))
+    {
+      throw std::runtime_error{ util::format("agent is failed, needs restart: {}",
+                                             runtime::to_string(object_ref{ error.load() })) };
+    }
+
+    auto const act(new action{});
+    act->fn = fn;
+    act->args = args;
+    act->executor = executor;
+    auto const &stack(thread_binding_stack::current());
+    if(current_action && stack.frames.size() == 1 && current_action_frames == 1)
+    {
+      /* Nothing has been bound within the running action, so the thread's bindings are just
+       * the ones the action was sent with. We already have those as a map. */
+      act->bindings = current_action->bindings;
+    }
+    else if(!stack.frames.empty())
+    {
+      act->bindings = stack.to_map();
+    }
+
+    if(current_agent)
+    {
+      current_agent->held_sends.emplace_back(this, act);
+    }
+    else
+    {
+      enqueue(this, act);
+    }
+    return this;
+  }
+
+  static object_ref run_action(agent * const a, agent::action const &act)
+  {
+    try
+    {
+      /* *agent* goes on top of the conveyed bindings, since those hold the sender's own
+       * *agent* when one agent sends to another. */
+      auto const agent_var(__rt_ctx->agent_var);
+      auto const bindings(
+        act.bindings.is_some()
+          ? expect_object<persistent_hash_map>(act.bindings)->assoc(agent_var, agent_ref{ a })
+          : persistent_hash_map::create_unique(std::make_pair(agent_var, agent_ref{ a })));
+      __rt_ctx->push_thread_bindings(bindings).expect_ok();
+      util::scope_exit const pop_bindings{ [] { __rt_ctx->pop_thread_bindings().expect_ok(); } };
+
+      auto const previous_action(current_action);
+      auto const previous_frames(current_action_frames);
+      current_action = &act;
+      current_action_frames = thread_binding_stack::current().frames.size();
+      util::scope_exit const restore_action{ [previous_action, previous_frames] {
+        current_action = previous_action;
+        current_action_frames = previous_frames;
+      } };
+
+      object_ref const old_state{ a->state.load() };
+      auto const new_state(act.args.is_nil()
+                             ? dynamic_call(act.fn, old_state)
+                             : apply_to(act.fn, make_box<cons>(old_state, act.args)));
+      validate(a->validator.load(), new_state);
+      a->state.store(new_state.data);
+      return {};
+    }
+    catch(std::exception const &e)
+    {
+      return make_box(e.what());
+    }
+    catch(object_ref const e)
+    {
+      return e;
+    }
+    catch(...)
+    {
+      return make_box("unknown exception in agent action");
+    }
+  }
+
+  /* Returns true if the agent is now failed. */
+  static bool handle_error(agent * const a, object_ref const error)
+  {
+    a->held_sends.clear();
+
+    object_ref const handler{ a->error_handler.load() };
+    if(handler.is_some())
+    {
+      try
+      {
+        dynamic_call(handler, a, error);
+      }
+      catch(...)
+      {
+        /* Errors from the error handler are ignored, as in Clojure. */
+      }
+    }
+
+    if(a->mode.load() == agent::error_mode::continue_)
+    {
+      return false;
+    }
+
+    a->error.store(error.data);
+    return true;
+  }
+
+  void agent::drain(object_ref const executor)
+  {
+    if(is_failed(this))
+    {
+      park(this);
+      return;
+    }
+
+    auto const previous_agent(current_agent);
+    current_agent = this;
+    util::scope_exit const restore_agent{ [previous_agent] { current_agent = previous_agent; } };
+
+    auto const available(std::min(queued.load(std::memory_order_acquire), batch_size));
+    usize ran{};
+    auto failed(false);
+    for(; ran < available && !failed; ++ran)
+    {
+      auto const act(next_action(tail));
+      if(act->executor != executor)
+      {
+        break;
+      }
+
+      /* The action becomes the new tail, but we don't need its data anymore. */
+      tail = act;
+      auto const error(run_action(this, *act));
+      act->fn = jank_nil;
+      act->args = jank_nil;
+      act->bindings = jank_nil;
+
+      if(error.is_some())
+      {
+        failed = handle_error(this, error);
+      }
+      else
+      {
+        release_pending_sends();
+      }
+    }
+
+    auto const remaining(queued.fetch_sub(ran, std::memory_order_acq_rel) - ran);
+    if(remaining == 0)
+    {
+      return;
+    }
+
+    if(failed)
+    {
+      park(this);
+    }
+    else
+    {
+      resume(this);
+    }
+  }
+
+  usize agent::release_pending_sends()
+  {
+    if(!current_agent)
+    {
+      return 0;
+    }
+
+    auto &held(current_agent->held_sends);
+    auto const count(held.size());
+    for(auto const &send : held)
+    {
+      enqueue(send.first, send.second);
+    }
+    held.clear();
+    return count;
+  }
+
+  void agent::shutdown()
+  {
+    shut_down.store(true);
+  }
+
+  void agent::set_validator(object_ref const fn)
+  {
+    validate(fn, state.load());
+    validator.store(fn.data);
+  }
+
+  object_ref agent::get_validator() const
+  {
+    return validator.load();
+  }
+
+  void agent::set_error_handler(object_ref const fn)
+  {
+    error_handler.store(fn.data);
+  }
+
+  object_ref agent::get_error_handler() const
+  {
+    return error_handler.load();
+  }
+
+  void agent::set_error_mode(object_ref const mode)
+  {
+    if(is_keyword(mode, "continue"))
+    {
+      this->mode.store(error_mode::continue_);
+    }
+    else if(is_keyword(mode, "fail"))
+    {
+      this->mode.store(error_mode::fail);
+    }
+    else
+    {
+      throw std::runtime_error{ util::format("invalid agent error mode: {}",
+                                             runtime::to_string(mode)) };
+    }
+  }
+
+  object_ref agent::get_error_mode() const
+  {
+    return __rt_ctx->intern_keyword(mode.load() == error_mode::continue_ ? "continue" : "fail")
+      .expect_ok();
+  }
+
+  object_ref agent::get_error() const
+  {
+    return error.load();
+  }
+
+  object_ref agent::restart(object_ref const new_state, bool const clear_actions)
+  {
+    if(!is_failed(this))
+    {
+      throw std::runtime_error{ "agent does not need a restart" };
+    }
+
+    validate(validator.load(), new_state);
+    state.store(new_state.data);
+
+    /* If the agent parked itself, we now own its queue, so we're free to drop from it. */
+    auto const owned(parked.exchange(false));
+    auto remaining(queued.load(std::memory_order_acquire));
+    if(owned && clear_actions)
+    {
+      for(usize i{}; i < remaining; ++i)
+      {
+        tail = next_action(tail);
+        tail->fn = jank_nil;
+        tail->args = jank_nil;
+        tail->bindings = jank_nil;
+      }
+      remaining = queued.fetch_sub(remaining, std::memory_order_acq_rel) - remaining;
+    }
+
+    error.store(object_ref{}.data);
+    if(owned && remaining != 0)
+    {
+      resume(this);
+    }
+    return new_state;
+  }
+}
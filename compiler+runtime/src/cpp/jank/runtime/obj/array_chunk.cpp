@@ -8,18 +8,33 @@ namespace jank::runtime::obj
 {
   array_chunk::array_chunk(native_vector<object_ref> const &buffer)
     : buffer{ buffer }
+    , items{ this->buffer.data() }
+    , size{ this->buffer.size() }
   {
   }
 
   array_chunk::array_chunk(native_vector<object_ref> const &buffer, usize const offset)
     : buffer{ buffer }
+    , items{ this->buffer.data() }
     , offset{ offset }
+    , size{ this->buffer.size() }
   {
   }
 
   array_chunk::array_chunk(native_vector<object_ref> &&buffer, usize const offset)
     : buffer{ std::move(buffer) }
+    , items{ this->buffer.data() }
     , offset{ offset }
+    , size{ this->buffer.size() }
+  {
+  }
+
+  array_chunk::array_chunk(object_ref const owner,
+                           object_ref const * const begin,
+                           object_ref const * const end)
+    : owner{ owner }
+    , items{ begin }
+    , size{ static_cast<usize>(end - begin) }
   {
   }
 
@@ -52,17 +67,20 @@ namespace jank::runtime::obj
 
   array_chunk_ref array_chunk::chunk_next() const
   {
-    if(offset == buffer.size())
+    if(offset == size)
     {
       throw std::runtime_error{ "no more chunk remaining to chunk_next" };
     }
-    /* TODO: This copying will be slow. Use a persistent_vector? */
-    return make_box<array_chunk>(buffer, offset + 1);
+    /* The new chunk is a view into whatever keeps our elements alive, which is us if we own
+     * our buffer. */
+    auto const keep_alive(owner.is_some() ? owner
+                                          : object_ref{ const_cast<object *>(&base) });
+    return make_box<array_chunk>(keep_alive, items + offset + 1, items + size);
   }
 
   array_chunk_ref array_chunk::chunk_next_in_place()
   {
-    if(offset == buffer.size())
+    if(offset == size)
     {
       throw std::runtime_error{ "no more chunk remaining to chunk_next" };
     }
@@ -72,7 +90,7 @@ namespace jank::runtime::obj
 
   usize array_chunk::count() const
   {
-    return buffer.size() - offset;
+    return size - offset;
   }
 
   object_ref array_chunk::nth(object_ref const index) const
@@ -80,15 +98,15 @@ namespace jank::runtime::obj
     if(index->type == object_type::integer)
     {
       auto const i(expect_object<integer>(index)->data);
-      if(i < 0 || buffer.size() - offset <= static_cast<size_t>(i))
+      if(i < 0 || size - offset <= static_cast<size_t>(i))
       {
         throw std::runtime_error{ util::format(
           "out of bounds index {}; array_chunk has a size of {} and offset of {}",
           i,
-          buffer.size(),
+          size,
           offset) };
       }
-      return buffer[offset + i];
+      return items[offset + i];
     }
     else
     {
@@ -102,11 +120,11 @@ namespace jank::runtime::obj
     if(index->type == object_type::integer)
     {
       auto const i(expect_object<integer>(index)->data);
-      if(i < 0 || buffer.size() - offset <= static_cast<size_t>(i))
+      if(i < 0 || size - offset <= static_cast<size_t>(i))
       {
         return fallback;
       }
-      return buffer[offset + i];
+      return items[offset + i];
     }
     else
     {
@@ -118,13 +118,36 @@ namespace jank::runtime::obj::detail
   template <typename PT, typename ST, typename V>
   uhash base_persistent_map<PT, ST, V>::to_hash() const
   {
-    if(hash)
+    if(entries_hash == 0)
     {
-      return hash;
+      entries_hash = hash::unordered_sum(static_cast<PT const *>(this)->data.begin(),
+                                         static_cast<PT const *>(this)->data.end());
     }
 
-    return hash = hash::unordered(static_cast<PT const *>(this)->data.begin(),
-                                  static_cast<PT const *>(this)->data.end());
+    return hash::mix_collection_hash(entries_hash, count());
+  }
+
+  template <typename PT, typename ST, typename V>
+  uhash base_persistent_map<PT, ST, V>::derived_hash(object_ref const key,
+                                                     jtl::option<object_ref> const &val) const
+  {
+    if(entries_hash == 0 || !hash::is_cached(key)
+       || (val.is_some() && !hash::is_cached(val.unwrap())))
+    {
+      return 0;
+    }
+
+    auto const self(static_cast<PT const *>(this));
+    auto sum(entries_hash);
+    if(self->contains(key))
+    {
+      sum -= hash::unordered_entry(key, self->get(key));
+    }
+    if(val.is_some())
+    {
+      sum += hash::unordered_entry(key, val.unwrap());
+    }
+    return sum;
   }
 
   template <typename PT, typename ST, typename V>
@@ -193,6 +216,7 @@ namespace jank::runtime::obj::detail
     auto const meta(behavior::detail::validate_meta(m));
     auto ret(make_box<PT>(static_cast<PT const *>(this)->data));
     ret->meta = meta;
+    ret->entries_hash = entries_hash;
     return ret;
   }
 
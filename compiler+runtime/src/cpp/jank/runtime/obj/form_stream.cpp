@@ -0,0 +1,63 @@
+#include <jank/runtime/obj/form_stream.hpp>
+#include <jank/read/stream.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  form_stream::form_stream(read::stream * const s)
+    : stream{ s }
+  {
+  }
+
+  bool form_stream::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  jtl::immutable_string form_stream::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void form_stream::to_string(util::string_builder &buff) const
+  {
+    util::format_to(buff, "{}@{}", object_type_str(base.type), &base);
+  }
+
+  jtl::immutable_string form_stream::to_code_string() const
+  {
+    return to_string();
+  }
+
+  uhash form_stream::to_hash() const
+  {
+    return static_cast<uhash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ref form_stream::next(object_ref const eof, bool const source_meta)
+  {
+    if(!stream)
+    {
+      throw std::runtime_error{ "unable to read from a closed reader" };
+    }
+
+    stream->source_meta = source_meta;
+    auto const res(stream->next());
+    if(res.is_err())
+    {
+      throw std::runtime_error{ res.expect_err().c_str() };
+    }
+    return res.expect_ok().unwrap_or(eof);
+  }
+
+  void form_stream::close()
+  {
+    if(stream)
+    {
+      stream->close();
+      stream = nullptr;
+    }
+  }
+}
@@ -0,0 +1,175 @@
+#include <jank/runtime/obj/future.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/work_pool.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::runtime::obj
+{
+  future::future(object_ref const fn, object_ref const bindings)
+    : fn{ fn }
+    , bindings{ bindings }
+  {
+  }
+
+  future_ref future::submit(object_ref const fn, object_ref const bindings)
+  {
+    auto const ret(make_box<future>(fn, bindings));
+    /* Futures may block, on promises, IO, or other futures, so they get a pool which grows
+     * rather than one which could have every worker tied up. The work only holds the
+     * future, which fits in the work's inline storage, so the GC can always see it. */
+    growing_pool::global().submit([f = &*ret] { f->run(); });
+    return ret;
+  }
+
+  bool future::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  jtl::immutable_string future::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void future::to_string(util::string_builder &buff) const
+  {
+    util::format_to(buff, "{}@{}", object_type_str(base.type), &base);
+  }
+
+  jtl::immutable_string future::to_code_string() const
+  {
+    return to_string();
+  }
+
+  uhash future::to_hash() const
+  {
+    return static_cast<uhash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  void future::run()
+  {
+    auto expected{ future_state::pending };
+    if(!state.compare_exchange_strong(expected, future_state::running))
+    {
+      return;
+    }
+
+    auto next{ future_state::done };
+    object_ref result{};
+    object_ref failure{};
+    try
+    {
+      if(bindings.is_some())
+      {
+        __rt_ctx->push_thread_bindings(bindings).expect_ok();
+      }
+      util::scope_exit const pop_bindings{ [this] {
+        if(bindings.is_some())
+        {
+          __rt_ctx->pop_thread_bindings().expect_ok();
+        }
+      } };
+
+      result = dynamic_call(fn);
+    }
+    catch(std::exception const &e)
+    {
+      next = future_state::failed;
+      failure = make_box(e.what());
+    }
+    catch(object_ref const e)
+    {
+      next = future_state::failed;
+      failure = e;
+    }
+    catch(...)
+    {
+      next = future_state::failed;
+      failure = make_box("unknown exception in future");
+    }
+
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      val = result;
+      error = failure;
+      fn = jank_nil;
+      bindings = jank_nil;
+      state.store(next);
+    }
+    finished.notify_all();
+  }
+
+  bool future::cancel()
+  {
+    auto expected{ future_state::pending };
+    if(!state.compare_exchange_strong(expected, future_state::cancelled))
+    {
+      return false;
+    }
+
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      fn = jank_nil;
+      bindings = jank_nil;
+    }
+    finished.notify_all();
+    return true;
+  }
+
+  bool future::is_cancelled() const
+  {
+    return state.load() == future_state::cancelled;
+  }
+
+  bool future::is_realized() const
+  {
+    auto const s(state.load());
+    return s != future_state::pending && s != future_state::running;
+  }
+
+  static object_ref finished_value(future const &f)
+  {
+    switch(f.state.load())
+    {
+      case future::future_state::done:
+        return f.val;
+      case future::future_state::failed:
+        throw f.error;
+      case future::future_state::cancelled:
+        throw std::runtime_error{ "future has been cancelled" };
+      default:
+        throw std::runtime_error{ "future has not finished" };
+    }
+  }
+
+  object_ref future::deref()
+  {
+    /* If nobody has picked this future up yet, we do it ourselves rather than wait. This
+     * keeps futures which deref other futures from deadlocking the pool. */
+    run();
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    finished.wait(lock, [this] { return is_realized(); });
+    lock.unlock();
+    return finished_value(*this);
+  }
+
+  object_ref future::deref(object_ref const timeout_ms, object_ref const timeout_val)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    if(!finished.wait_for(lock, std::chrono::milliseconds{ to_int(timeout_ms) }, [this] {
+         return is_realized();
+       }))
+    {
+      return timeout_val;
+    }
+    lock.unlock();
+    return finished_value(*this);
+  }
+}
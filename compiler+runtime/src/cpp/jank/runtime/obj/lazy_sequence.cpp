@@ -157,4 +157,9 @@ namespace jank::runtime::obj
     ret->meta = meta;
     return ret;
   }
+
+  bool lazy_sequence::is_realized() const
+  {
+    return fn.is_nil();
+  }
 }
@@ -68,13 +68,17 @@ namespace jank::runtime::obj
      * TODO: Benchmark if it's faster to have this behavior or to check first. */
     if(data.size() == runtime::detail::native_persistent_array_map::max_size)
     {
-      return make_box<persistent_hash_map>(meta, data, key, val);
+      auto ret(make_box<persistent_hash_map>(meta, data, key, val));
+      ret->entries_hash = derived_hash(key, val);
+      return ret;
     }
     else
     {
       auto copy(data.clone());
       copy.insert_or_assign(key, val);
-      return make_box<persistent_array_map>(meta, std::move(copy));
+      auto ret(make_box<persistent_array_map>(meta, std::move(copy)));
+      ret->entries_hash = derived_hash(key, val);
+      return ret;
     }
   }
 
@@ -82,7 +86,9 @@ namespace jank::runtime::obj
   {
     auto copy(data.clone());
     copy.erase(key);
-    return make_box<persistent_array_map>(meta, std::move(copy));
+    auto ret(make_box<persistent_array_map>(meta, std::move(copy)));
+    ret->entries_hash = derived_hash(key, none);
+    return ret;
   }
 
   object_ref persistent_array_map::call(object_ref const o) const
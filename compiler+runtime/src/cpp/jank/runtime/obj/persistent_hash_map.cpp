@@ -105,13 +105,17 @@ namespace jank::runtime::obj
   persistent_hash_map::assoc(object_ref const key, object_ref const val) const
   {
     auto copy(data.set(key, val));
-    return make_box<persistent_hash_map>(meta, std::move(copy));
+    auto ret(make_box<persistent_hash_map>(meta, std::move(copy)));
+    ret->entries_hash = derived_hash(key, val);
+    return ret;
   }
 
   persistent_hash_map_ref persistent_hash_map::dissoc(object_ref const key) const
   {
     auto copy(data.erase(key));
-    return make_box<persistent_hash_map>(meta, std::move(copy));
+    auto ret(make_box<persistent_hash_map>(meta, std::move(copy)));
+    ret->entries_hash = derived_hash(key, none);
+    return ret;
   }
 
   object_ref persistent_hash_map::call(object_ref const o) const
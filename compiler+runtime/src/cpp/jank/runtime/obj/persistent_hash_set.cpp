@@ -88,10 +88,14 @@ namespace jank::runtime::obj
     return buff.release();
   }
 
-  /* TODO: Cache this. */
   uhash persistent_hash_set::to_hash() const
   {
-    return hash::unordered(data.begin(), data.end());
+    if(items_hash == 0)
+    {
+      items_hash = hash::unordered_sum(data.begin(), data.end());
+    }
+
+    return hash::mix_collection_hash(items_hash, data.size());
   }
 
   persistent_hash_set_sequence_ref persistent_hash_set::seq() const
@@ -118,6 +122,7 @@ namespace jank::runtime::obj
     auto const meta(behavior::detail::validate_meta(m));
     auto ret(make_box<persistent_hash_set>(data));
     ret->meta = meta;
+    ret->items_hash = items_hash;
     return ret;
   }
 
@@ -125,6 +130,10 @@ namespace jank::runtime::obj
   {
     auto set(data.insert(head));
     auto ret(make_box<persistent_hash_set>(meta, std::move(set)));
+    if(items_hash != 0 && hash::is_cached(head))
+    {
+      ret->items_hash = items_hash + (contains(head) ? 0 : hash::unordered_entry(head));
+    }
     return ret;
   }
 
@@ -152,6 +161,10 @@ namespace jank::runtime::obj
   {
     auto set(data.erase(o));
     auto ret(make_box<persistent_hash_set>(meta, std::move(set)));
+    if(items_hash != 0 && hash::is_cached(o))
+    {
+      ret->items_hash = items_hash - (contains(o) ? hash::unordered_entry(o) : 0);
+    }
     return ret;
   }
 }
@@ -107,13 +107,30 @@ namespace jank::runtime::obj
   persistent_sorted_map::assoc(object_ref const key, object_ref const val) const
   {
     auto copy(data.insert_or_assign(key, val));
-    return make_box<persistent_sorted_map>(meta, std::move(copy));
+    auto ret(make_box<persistent_sorted_map>(meta, std::move(copy)));
+    if(entries_hash != 0 && hash::is_cached(key) && hash::is_cached(val))
+    {
+      /* Keys which compare the same can still hash differently, such as 1 and 1.0, so we
+       * need the entries which are actually stored, rather than the key we were given. */
+      auto const prev(data.find(key));
+      auto const next(ret->data.find(key));
+      ret->entries_hash = entries_hash + hash::unordered_entry(next->first, next->second)
+        - (prev == data.end() ? 0 : hash::unordered_entry(prev->first, prev->second));
+    }
+    return ret;
   }
 
   persistent_sorted_map_ref persistent_sorted_map::dissoc(object_ref const key) const
   {
     auto copy(data.erase_key(key));
-    return make_box<persistent_sorted_map>(meta, std::move(copy));
+    auto ret(make_box<persistent_sorted_map>(meta, std::move(copy)));
+    if(entries_hash != 0)
+    {
+      auto const prev(data.find(key));
+      ret->entries_hash = entries_hash
+        - (prev == data.end() ? 0 : hash::unordered_entry(prev->first, prev->second));
+    }
+    return ret;
   }
 
   object_ref persistent_sorted_map::call(object_ref const o) const
@@ -95,10 +95,14 @@ namespace jank::runtime::obj
     return buff.release();
   }
 
-  /* TODO: Cache this. */
   uhash persistent_sorted_set::to_hash() const
   {
-    return hash::unordered(data.begin(), data.end());
+    if(items_hash == 0)
+    {
+      items_hash = hash::unordered_sum(data.begin(), data.end());
+    }
+
+    return hash::mix_collection_hash(items_hash, data.size());
   }
 
   persistent_sorted_set_sequence_ref persistent_sorted_set::seq() const
@@ -125,6 +129,7 @@ namespace jank::runtime::obj
     auto const meta(behavior::detail::validate_meta(m));
     auto ret(make_box<persistent_sorted_set>(data));
     ret->meta = meta;
+    ret->items_hash = items_hash;
     return ret;
   }
 
@@ -132,6 +137,14 @@ namespace jank::runtime::obj
   {
     auto set(data.insert_v(head));
     auto ret(make_box<persistent_sorted_set>(meta, std::move(set)));
+    if(items_hash != 0 && hash::is_cached(head))
+    {
+      /* Items which compare the same can still hash differently, such as 1 and 1.0, so we
+       * need the items which are actually stored, rather than the one we were given. */
+      auto const prev(data.find(head));
+      ret->items_hash = items_hash + hash::unordered_entry(*ret->data.find(head))
+        - (prev == data.end() ? 0 : hash::unordered_entry(*prev));
+    }
     return ret;
   }
 
@@ -159,6 +172,11 @@ namespace jank::runtime::obj
   {
     auto set(data.erase_key(o));
     auto ret(make_box<persistent_sorted_set>(meta, std::move(set)));
+    if(items_hash != 0)
+    {
+      auto const prev(data.find(o));
+      ret->items_hash = items_hash - (prev == data.end() ? 0 : hash::unordered_entry(*prev));
+    }
     return ret;
   }
 }
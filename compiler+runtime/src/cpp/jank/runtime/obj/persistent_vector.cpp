@@ -110,12 +110,12 @@ namespace jank::runtime::obj
 
   uhash persistent_vector::to_hash() const
   {
-    if(hash != 0)
+    if(items_hash == 0)
     {
-      return hash;
+      items_hash = hash::ordered_sum(data.begin(), data.end());
     }
 
-    return hash = hash::ordered(data.begin(), data.end());
+    return hash::mix_collection_hash(items_hash, data.size());
   }
 
   i64 persistent_vector::compare(object const &o) const
@@ -173,6 +173,10 @@ namespace jank::runtime::obj
   {
     auto vec(data.push_back(head));
     auto ret(make_box<persistent_vector>(meta, std::move(vec)));
+    if(items_hash != 0 && hash::is_cached(head))
+    {
+      ret->items_hash = hash::ordered_push(items_hash, hash::visit(head));
+    }
     return ret;
   }
 
@@ -186,6 +190,7 @@ namespace jank::runtime::obj
     auto const meta(behavior::detail::validate_meta(m));
     auto ret(make_box<persistent_vector>(data));
     ret->meta = meta;
+    ret->items_hash = items_hash;
     return ret;
   }
 
@@ -259,7 +264,13 @@ namespace jank::runtime::obj
       throw std::runtime_error{ "cannot pop an empty vector" };
     }
 
-    return make_box<persistent_vector>(meta, data.take(data.size() - 1));
+    auto ret(make_box<persistent_vector>(meta, data.take(data.size() - 1)));
+    if(items_hash != 0)
+    {
+      /* We've been hashed, so the last item has been too. */
+      ret->items_hash = hash::ordered_pop(items_hash, hash::visit(data[data.size() - 1]));
+    }
+    return ret;
   }
 
   object_ref persistent_vector::nth(object_ref const index) const
@@ -1,5 +1,8 @@
 #include <jank/runtime/obj/persistent_vector_sequence.hpp>
+#include <immer/algorithm.hpp>
+
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/seq_ext.hpp>
 
@@ -122,4 +125,40 @@ namespace jank::runtime::obj
   {
     return make_box<cons>(head, this);
   }
+
+  /* Finds the contiguous run of elements, within a single leaf, which starts at the given
+   * index. immer gives us pointers straight into the leaf, so nothing is copied. */
+  static std::pair<object_ref const *, object_ref const *>
+  leaf_at(persistent_vector_ref const vec, usize const index)
+  {
+    std::pair<object_ref const *, object_ref const *> ret{};
+    immer::for_each_chunk_p(
+      vec->data.begin() + static_cast<decltype(persistent_vector::data)::difference_type>(index),
+      vec->data.end(),
+      [&](auto const first, auto const last) {
+        ret = { first, last };
+        return false;
+      });
+    return ret;
+  }
+
+  /* behavior::chunkable */
+  array_chunk_ref persistent_vector_sequence::chunked_first() const
+  {
+    auto const leaf(leaf_at(vec, index));
+    return make_box<array_chunk>(vec, leaf.first, leaf.second);
+  }
+
+  persistent_vector_sequence_ref persistent_vector_sequence::chunked_next() const
+  {
+    auto const leaf(leaf_at(vec, index));
+    auto const n(index + static_cast<usize>(leaf.second - leaf.first));
+
+    if(n == vec->data.size())
+    {
+      return {};
+    }
+
+    return make_box<persistent_vector_sequence>(vec, n);
+  }
 }
@@ -0,0 +1,87 @@
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  bool promise::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  jtl::immutable_string promise::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void promise::to_string(util::string_builder &buff) const
+  {
+    util::format_to(buff, "{}@{}", object_type_str(base.type), &base);
+  }
+
+  jtl::immutable_string promise::to_code_string() const
+  {
+    return to_string();
+  }
+
+  uhash promise::to_hash() const
+  {
+    return static_cast<uhash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ref promise::deref()
+  {
+    if(delivered.load())
+    {
+      return val;
+    }
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    delivery.wait(lock, [this] { return delivered.load(); });
+    return val;
+  }
+
+  object_ref promise::deref(object_ref const timeout_ms, object_ref const timeout_val)
+  {
+    if(delivered.load())
+    {
+      return val;
+    }
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    if(!delivery.wait_for(lock, std::chrono::milliseconds{ to_int(timeout_ms) }, [this] {
+         return delivered.load();
+       }))
+    {
+      return timeout_val;
+    }
+    return val;
+  }
+
+  bool promise::is_realized() const
+  {
+    return delivered.load();
+  }
+
+  object_ref promise::deliver(object_ref const o)
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(delivered.load())
+      {
+        return jank_nil;
+      }
+      val = o;
+      delivered.store(true);
+    }
+    delivery.notify_all();
+    return this;
+  }
+
+  object_ref promise::call(object_ref const o)
+  {
+    return deliver(o);
+  }
+}
@@ -19,25 +19,41 @@ namespace jank::runtime::obj
     }
   }
 
+  /* Symbols are hashed whenever they're looked up, which is most of what the compiler does
+   * with them, so every symbol is hashed once, when it's made. */
+  static uhash hash_of(jtl::immutable_string const &ns, jtl::immutable_string const &name)
+  {
+    return hash::combine(hash::string(name), hash::string(ns));
+  }
+
+  symbol::symbol()
+    : hash{ hash_of(ns, name) }
+  {
+  }
+
   symbol::symbol(jtl::immutable_string const &d)
   {
     separate(*this, d);
+    hash = hash_of(ns, name);
   }
 
   symbol::symbol(jtl::immutable_string &&d)
   {
     separate(*this, std::move(d));
+    hash = hash_of(ns, name);
   }
 
   symbol::symbol(jtl::immutable_string const &ns, jtl::immutable_string const &n)
     : ns{ ns }
     , name{ n }
+    , hash{ hash_of(ns, n) }
   {
   }
 
   symbol::symbol(jtl::immutable_string &&ns, jtl::immutable_string &&n)
     : ns{ std::move(ns) }
     , name{ std::move(n) }
+    , hash{ hash_of(this->ns, name) }
   {
   }
 
@@ -47,12 +63,14 @@ namespace jank::runtime::obj
     : ns{ ns }
     , name{ n }
     , meta{ meta }
+    , hash{ hash_of(ns, n) }
   {
   }
 
   symbol::symbol(object_ref const ns, object_ref const n)
     : ns{ runtime::to_string(ns) }
     , name{ runtime::to_string(n) }
+    , hash{ hash_of(this->ns, name) }
   {
   }
 
@@ -64,12 +82,13 @@ namespace jank::runtime::obj
     }
 
     auto const s(expect_object<symbol>(&o));
-    return ns == s->ns && name == s->name;
+    return equal(*s);
   }
 
+  /* Different hashes mean different symbols, without looking at the strings. */
   bool symbol::equal(symbol const &s) const
   {
-    return ns == s.ns && name == s.name;
+    return hash == s.hash && ns == s.ns && name == s.name;
   }
 
   i64 symbol::compare(object const &o) const
@@ -136,18 +155,13 @@ namespace jank::runtime::obj
 
   uhash symbol::to_hash() const
   {
-    if(hash)
-    {
-      return hash;
-    }
-
-    return hash = hash::combine(hash::string(name), hash::string(ns));
+    return hash;
   }
 
   symbol_ref symbol::with_meta(object_ref const m) const
   {
     auto const meta(behavior::detail::validate_meta(m));
-    auto ret(make_box<symbol>(ns, name));
+    auto ret(make_box<symbol>(*this));
     ret->meta = meta;
     return ret;
   }
@@ -175,13 +189,13 @@ namespace jank::runtime::obj
   void symbol::set_ns(jtl::immutable_string const &s)
   {
     ns = s;
-    hash = 0;
+    hash = hash_of(ns, name);
   }
 
   void symbol::set_name(jtl::immutable_string const &s)
   {
     name = s;
-    hash = 0;
+    hash = hash_of(ns, name);
   }
 }
 
@@ -4,6 +4,9 @@
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/profile/sample.hpp>
 #include <jank/util/fmt.hpp>
 
 namespace jank::runtime::perf
@@ -47,4 +50,24 @@ namespace jank::runtime::perf
       label_str);
     return jank_nil;
   }
+
+  object_ref start_sampling(object_ref const frequency)
+  {
+    auto const res(profile::sample::start(static_cast<u32>(to_int(frequency))));
+    if(res.is_err())
+    {
+      throw std::runtime_error{ res.expect_err() };
+    }
+    return jank_nil;
+  }
+
+  object_ref stop_sampling()
+  {
+    auto const res(profile::sample::stop());
+    if(res.is_err())
+    {
+      throw std::runtime_error{ res.expect_err() };
+    }
+    return make_box(res.expect_ok());
+  }
 }
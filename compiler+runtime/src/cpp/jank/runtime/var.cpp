@@ -16,14 +16,14 @@ namespace jank::runtime
   var::var(ns_ref const &n, obj::symbol_ref const &name)
     : n{ n }
     , name{ name }
-    , root{ make_box<var_unbound_root>(this) }
+    , root{ make_box<var_unbound_root>(this).erase() }
   {
   }
 
   var::var(ns_ref const &n, obj::symbol_ref const &name, object_ref const root)
     : n{ n }
     , name{ name }
-    , root{ root }
+    , root{ root.erase() }
   {
   }
 
@@ -34,7 +34,7 @@ namespace jank::runtime
            bool const thread_bound)
     : n{ n }
     , name{ name }
-    , root{ root }
+    , root{ root.erase() }
     , dynamic{ dynamic }
     , thread_bound{ thread_bound }
   {
@@ -99,29 +99,32 @@ namespace jank::runtime
     return deref()->type != object_type::var_unbound_root;
   }
 
-  object_ref var::get_root() const
-  {
-    profile::timer const timer{ "var get_root" };
-    return *root.rlock();
-  }
-
   var_ref var::bind_root(object_ref const r)
   {
-    profile::timer const timer{ "var bind_root" };
-    *root.wlock() = r;
+    profile::timer const timer{ profile::region<"var bind_root"> };
+    root.store(r.erase(), std::memory_order_release);
     return this;
   }
 
   object_ref var::alter_root(object_ref const f, object_ref const args)
   {
-    auto locked_root(root.wlock());
-    *locked_root = apply_to(f, cons(*locked_root, args));
-    return *locked_root;
+    auto current(root.load(std::memory_order_acquire));
+    while(true)
+    {
+      object_ref const next{ apply_to(f, cons(current, args)) };
+      if(root.compare_exchange_weak(current,
+                                    next.erase(),
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
+      {
+        return next;
+      }
+    }
   }
 
   jtl::string_result<void> var::set(object_ref const r) const
   {
-    profile::timer const timer{ "var set" };
+    profile::timer const timer{ profile::region<"var set"> };
 
     auto const binding(get_thread_binding());
     if(binding.is_nil())
@@ -146,25 +149,19 @@ namespace jank::runtime
 
   var_thread_binding_ref var::get_thread_binding() const
   {
-    if(!thread_bound.load())
-    {
-      return {};
-    }
-
-    auto &tbfs(n->rt_ctx.thread_binding_frames[&n->rt_ctx]);
-    if(tbfs.empty())
+    if(!thread_bound.load(std::memory_order_relaxed))
     {
       return {};
     }
 
-    auto const found(tbfs.front().bindings->get_entry(this));
-    if(found == jank_nil)
+    auto const &slots(thread_binding_stack::current().slots);
+    auto const index(binding_index.load(std::memory_order_relaxed));
+    if(slots.size() <= index || !slots[index].binding)
     {
       return {};
     }
 
-    auto const ret(expect_object<obj::persistent_vector>(found)->data[1]);
-    return expect_object<var_thread_binding>(ret);
+    return slots[index].binding;
   }
 
   object_ref var::deref() const
@@ -174,7 +171,7 @@ namespace jank::runtime
     {
       return binding->value;
     }
-    return *root.rlock();
+    return get_root();
   }
 
   var_ref var::clone() const
@@ -182,6 +179,128 @@ namespace jank::runtime
     return make_box<var>(n, name, get_root(), dynamic.load(), thread_bound.load());
   }
 
+  /* Index zero is never handed out, so that it can mean unassigned. */
+  static std::atomic<u32> next_binding_index{ 1 };
+
+  static u32 binding_index_for(var &v)
+  {
+    auto index(v.binding_index.load(std::memory_order_relaxed));
+    if(index)
+    {
+      return index;
+    }
+
+    /* If another thread beats us to it, we just use theirs. */
+    auto const fresh(next_binding_index.fetch_add(1, std::memory_order_relaxed));
+    if(v.binding_index.compare_exchange_strong(index, fresh, std::memory_order_relaxed))
+    {
+      return fresh;
+    }
+    return index;
+  }
+
+  thread_binding_stack &thread_binding_stack::current()
+  {
+    /* The GC doesn't scan thread local storage, so the stack itself lives in uncollectable
+     * GC memory, which is scanned, and TLS only holds onto it until the thread exits. */
+    struct owner
+    {
+      owner()
+        : stack{ new(GC_MALLOC_UNCOLLECTABLE(sizeof(thread_binding_stack)))
+                   thread_binding_stack{} }
+      {
+      }
+
+      ~owner()
+      {
+        stack->~thread_binding_stack();
+        GC_FREE(stack);
+      }
+
+      thread_binding_stack *stack{};
+    };
+
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    static thread_local owner o;
+    return *o.stack;
+  }
+
+  jtl::string_result<void>
+  thread_binding_stack::push(context const * const rt_ctx,
+                             obj::persistent_hash_map_ref const bindings)
+  {
+    auto const thread_id(std::this_thread::get_id());
+    auto const saved_offset(saved.size());
+
+    for(auto it(bindings->fresh_seq()); it.is_some(); it = it->next_in_place())
+    {
+      auto const entry(it->first());
+      auto const v(expect_object<var>(entry->data[0]));
+      if(!v->dynamic.load())
+      {
+        /* Undo whatever we've bound so far, so the stack is left as it was. */
+        for(auto i(saved.size()); saved_offset < i; --i)
+        {
+          slots[saved[i - 1].index] = saved[i - 1].previous;
+        }
+        saved.resize(saved_offset);
+        return err(util::format("Can't dynamically bind non-dynamic var: {}", v->to_string()));
+      }
+
+      /* XXX: Once this is set to true, here, it's never unset. */
+      v->thread_bound.store(true);
+
+      auto const index(binding_index_for(*v));
+      if(slots.size() <= index)
+      {
+        slots.resize(index + 1);
+      }
+
+      /* The binding may already be a thread binding if we're just pushing the previous
+       * bindings again to give a scratch pad for some upcoming code. */
+      auto const value(entry->data[1]->type == object_type::var_thread_binding
+                         ? expect_object<var_thread_binding>(entry->data[1])->value
+                         : entry->data[1]);
+
+      saved.push_back({ index, slots[index] });
+      slots[index] = { &*v, &*make_box<var_thread_binding>(value, thread_id) };
+    }
+
+    frames.push_back({ rt_ctx, saved_offset });
+    return ok();
+  }
+
+  jtl::string_result<void> thread_binding_stack::pop(context const * const rt_ctx)
+  {
+    if(frames.empty() || frames.back().rt_ctx != rt_ctx)
+    {
+      return err("Mismatched thread binding pop");
+    }
+
+    auto const saved_offset(frames.back().saved_offset);
+    for(auto i(saved.size()); saved_offset < i; --i)
+    {
+      slots[saved[i - 1].index] = saved[i - 1].previous;
+    }
+    saved.resize(saved_offset);
+    frames.pop_back();
+
+    return ok();
+  }
+
+  obj::persistent_hash_map_ref thread_binding_stack::to_map() const
+  {
+    auto ret(obj::persistent_hash_map::empty());
+    for(auto const &slot : slots)
+    {
+      if(slot.binding)
+      {
+        ret = ret->assoc(slot.bound_var, slot.binding);
+      }
+    }
+    return ret;
+  }
+
   var_thread_binding::var_thread_binding(object_ref const value, std::thread::id const id)
     : value{ value }
     , thread_id{ id }
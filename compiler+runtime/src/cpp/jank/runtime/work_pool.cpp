@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <new>
+
+#include <jank/runtime/work_pool.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/util/try.hpp>
+
+namespace jank::runtime
+{
+  /* Lets work which is submitted from within the pool go to the submitting worker's own
+   * deque, rather than to some other worker. */
+  static thread_local work_pool *current_pool{};
+  static thread_local usize current_index{};
+
+  work_pool::work_pool(usize const thread_count)
+    : worker_count{ std::max<usize>(thread_count, 1) }
+  {
+    /* The GC scans uncollectable memory, but not malloc'd memory. */
+    workers = static_cast<worker *>(GC_MALLOC_UNCOLLECTABLE(sizeof(worker) * worker_count));
+    std::uninitialized_default_construct_n(workers, worker_count);
+
+    GC_allow_register_threads();
+    for(usize i{}; i < worker_count; ++i)
+    {
+      std::thread{ [this, i] { run(i); } }.detach();
+    }
+  }
+
+  work_pool &work_pool::global()
+  {
+    /* This is never destroyed, so exiting doesn't wait on the workers. */
+    static auto const pool(new work_pool{ std::thread::hardware_concurrency() });
+    return *pool;
+  }
+
+  usize work_pool::size() const
+  {
+    return worker_count;
+  }
+
+  void work_pool::submit(work &&w)
+  {
+    auto const index(current_pool == this
+                       ? current_index
+                       : next_worker.fetch_add(1, std::memory_order_relaxed) % worker_count);
+
+    /* Pending is bumped before the work is visible, so it never drops below the amount of
+     * queued work. At worst, a worker wakes a moment early and looks again. */
+    {
+      std::lock_guard<std::mutex> const lock{ idle_mutex };
+      ++pending;
+    }
+    {
+      auto &target(workers[index]);
+      std::lock_guard<std::mutex> const lock{ target.mutex };
+      target.queue.emplace_back(std::move(w));
+    }
+    idle_cv.notify_one();
+  }
+
+  jtl::option<work_pool::work> work_pool::take(usize const index)
+  {
+    auto &self(workers[index]);
+    std::lock_guard<std::mutex> const lock{ self.mutex };
+    if(self.queue.empty())
+    {
+      return jtl::none;
+    }
+    auto w(std::move(self.queue.back()));
+    self.queue.pop_back();
+    return std::move(w);
+  }
+
+  jtl::option<work_pool::work> work_pool::steal(usize const thief)
+  {
+    for(usize i{ 1 }; i <= worker_count; ++i)
+    {
+      auto &victim(workers[(thief + i) % worker_count]);
+      std::lock_guard<std::mutex> const lock{ victim.mutex };
+      if(victim.queue.empty())
+      {
+        continue;
+      }
+      auto w(std::move(victim.queue.front()));
+      victim.queue.pop_front();
+      return std::move(w);
+    }
+    return jtl::none;
+  }
+
+  /* Futures capture their own failures, to be rethrown on deref. Anything else which
+   * escapes from work has nowhere else to go, so it's reported here and the worker carries
+   * on with the next unit of work. */
+  static void execute(work_pool::work const &w)
+  {
+    JANK_TRY
+    {
+      w();
+    }
+    JANK_CATCH(util::print_exception)
+    catch(...)
+    {
+      util::print_exception(jtl::immutable_string{ "unknown exception in pool work" });
+    }
+  }
+
+  bool work_pool::help()
+  {
+    auto const is_worker(current_pool == this);
+    jtl::option<work> w;
+    if(is_worker)
+    {
+      w = take(current_index);
+    }
+    if(w.is_none())
+    {
+      w = steal(is_worker ? current_index : next_worker.load(std::memory_order_relaxed));
+    }
+    if(w.is_none())
+    {
+      return false;
+    }
+
+    --pending;
+    execute(w.unwrap());
+    return true;
+  }
+
+  void work_pool::run(usize const index)
+  {
+    GC_stack_base stack_base{};
+    GC_get_stack_base(&stack_base);
+    GC_register_my_thread(&stack_base);
+    util::scope_exit const unregister{ [] { GC_unregister_my_thread(); } };
+
+    current_pool = this;
+    current_index = index;
+
+    while(true)
+    {
+      auto w(take(index));
+      if(w.is_none())
+      {
+        w = steal(index);
+      }
+
+      if(w.is_some())
+      {
+        --pending;
+        execute(w.unwrap());
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock{ idle_mutex };
+      idle_cv.wait(lock, [this] { return pending.load() != 0; });
+    }
+  }
+
+  growing_pool::growing_pool()
+  {
+    GC_allow_register_threads();
+  }
+
+  growing_pool &growing_pool::global()
+  {
+    /* This lives in static storage, which the GC scans, so queued work stays visible to it.
+     * It's never destroyed, so exiting doesn't wait on, or pull the pool out from under,
+     * threads which are still blocked. */
+    alignas(growing_pool) static char storage[sizeof(growing_pool)];
+    static auto const pool(new(storage) growing_pool{});
+    return *pool;
+  }
+
+  usize growing_pool::size() const
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    return threads;
+  }
+
+  void growing_pool::submit(work_pool::work &&w)
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      queue.emplace_back(std::move(w));
+      if(idle < queue.size())
+      {
+        /* The new thread counts as idle until it picks something up. */
+        ++idle;
+        ++threads;
+        std::thread{ [this] { run(); } }.detach();
+        return;
+      }
+    }
+    cv.notify_one();
+  }
+
+  void growing_pool::run()
+  {
+    GC_stack_base stack_base{};
+    GC_get_stack_base(&stack_base);
+    GC_register_my_thread(&stack_base);
+    util::scope_exit const unregister{ [] { GC_unregister_my_thread(); } };
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    while(true)
+    {
+      auto const has_work(
+        cv.wait_for(lock, std::chrono::minutes{ 1 }, [this] { return !queue.empty(); }));
+      --idle;
+      if(!has_work)
+      {
+        --threads;
+        return;
+      }
+
+      auto const w(std::move(queue.front()));
+      queue.pop_front();
+      lock.unlock();
+      execute(w);
+      lock.lock();
+      ++idle;
+    }
+  }
+}
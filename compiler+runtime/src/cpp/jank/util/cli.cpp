@@ -23,10 +23,39 @@ namespace jank::util::cli
     cli.add_flag("--profile", opts.profiler_enabled, "Enable compiler and runtime profiling.");
     cli.add_option("--profile-output",
                    opts.profiler_file,
-                   "The file to write profile entries (will be overwritten).");
+                   "The file to write binary profile records (will be overwritten). Use the "
+                   "profile-report command to read them.");
+    cli.add_option("--profile-sample",
+                   opts.profile_sample_file,
+                   "Sample the whole run and write folded stacks, for flame graphs, to this file.");
+    cli.add_option("--profile-sample-frequency",
+                   opts.profile_sample_frequency,
+                   "How many times per second of CPU time to sample, with --profile-sample.")
+      ->check(CLI::Range(1, 1'000'000));
     cli.add_flag("--gc-incremental", opts.gc_incremental, "Enable incremental GC collection.");
+
+    /* Evaluation. */
+    cli.add_flag("--interpret",
+                 opts.interpreter_enabled,
+                 "Interpret evaluated forms, rather than JIT compiling each of them.");
+    cli.add_option("--interpret-jit-threshold",
+                   opts.interpreter_jit_threshold,
+                   "The number of calls after which an interpreted fn is JIT compiled. Use 0 to "
+                   "never JIT compile interpreted fns.");
     cli.add_option("-O,--optimization", opts.optimization_level, "The optimization level to use.")
       ->check(CLI::Range(0, 3));
+    cli.add_flag("--lazy-jit,!--no-lazy-jit",
+                 opts.lazy_jit,
+                 "Only JIT compile fns once they're first called.");
+    cli.add_flag("--jit-cache,!--no-jit-cache",
+                 opts.jit_cache,
+                 "Cache JIT compiled objects for evaluated forms in the user cache dir. Modules "
+                 "are only added to the cache when they're compiled up front, with "
+                 "--no-lazy-jit, but they're read from it either way.");
+    cli.add_option("--tier-up-threshold",
+                   opts.tier_up_threshold,
+                   "The number of calls after which a JIT compiled fn is recompiled, in the "
+                   "background, with full optimizations. Use 0 to disable tiered compilation.");
 
     /* Native dependencies. */
     cli.add_option("-I,--include-dir",
@@ -76,6 +105,15 @@ namespace jank::util::cli
     cli_run_main.fallthrough();
     cli_run_main.add_option("module", opts.target_module, "The entrypoint module.")->required();
 
+    /* Profile report subcommand. */
+    auto &cli_profile_report(*cli.add_subcommand(
+      "profile-report",
+      "Print the binary records written by --profile as text, one per line."));
+    cli_profile_report
+      .add_option("file", opts.profile_report_file, "The profile file, from --profile-output.")
+      ->check(CLI::ExistingFile)
+      ->required();
+
     cli.require_subcommand(1);
     cli.failure_message(CLI::FailureMessage::help);
     cli.allow_extras();
@@ -114,6 +152,10 @@ namespace jank::util::cli
     {
       opts.command = command::run_main;
     }
+    else if(cli.got_subcommand(&cli_profile_report))
+    {
+      opts.command = command::profile_report;
+    }
 
     return ok(opts);
   }
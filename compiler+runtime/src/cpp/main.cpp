@@ -21,6 +21,7 @@
 #include <jank/evaluate.hpp>
 #include <jank/jit/processor.hpp>
 #include <jank/profile/time.hpp>
+#include <jank/profile/sample.hpp>
 #include <jank/error/report.hpp>
 #include <jank/util/scope_exit.hpp>
 #include <jank/util/string.hpp>
@@ -31,6 +32,7 @@
 #include <jank/perf_native.hpp>
 #include <clojure/core_native.hpp>
 #include <clojure/string_native.hpp>
+#include <clojure/edn_native.hpp>
 
 namespace jank
 {
@@ -40,12 +42,12 @@ namespace jank
     using namespace jank::runtime;
 
     {
-      profile::timer const timer{ "load clojure.core" };
+      profile::timer const timer{ profile::region<"load clojure.core"> };
       __rt_ctx->load_module("/clojure.core", module::origin::latest).expect_ok();
     }
 
     {
-      profile::timer const timer{ "eval user code" };
+      profile::timer const timer{ profile::region<"eval user code"> };
       std::cout << runtime::to_code_string(__rt_ctx->eval_file(opts.target_file)) << "\n";
     }
 
@@ -72,12 +74,12 @@ namespace jank
     using namespace jank::runtime;
 
     {
-      profile::timer const timer{ "require clojure.core" };
+      profile::timer const timer{ profile::region<"require clojure.core"> };
       __rt_ctx->load_module("/clojure.core", module::origin::latest).expect_ok();
     }
 
     {
-      profile::timer const timer{ "eval user code" };
+      profile::timer const timer{ profile::region<"eval user code"> };
       __rt_ctx->load_module("/" + opts.target_module, module::origin::latest).expect_ok();
 
       auto const main_var(__rt_ctx->find_var(opts.target_module, "-main"));
@@ -124,13 +126,13 @@ namespace jank
     }
 
     {
-      profile::timer const timer{ "require clojure.core" };
+      profile::timer const timer{ profile::region<"require clojure.core"> };
       __rt_ctx->load_module("/clojure.core", module::origin::latest).expect_ok();
     }
 
     if(!opts.target_module.empty())
     {
-      profile::timer const timer{ "load main" };
+      profile::timer const timer{ profile::region<"load main"> };
       __rt_ctx->load_module("/" + opts.target_module, module::origin::latest).expect_ok();
       dynamic_call(__rt_ctx->in_ns_var->deref(), make_box<obj::symbol>(opts.target_module));
     }
@@ -188,19 +190,33 @@ namespace jank
     }
   }
 
+  static int profile_report(util::cli::options const &opts)
+  {
+    auto const res(profile::decode(opts.profile_report_file.c_str()));
+    if(res.is_err())
+    {
+      util::println(stderr, "{}", res.expect_err());
+      return 1;
+    }
+
+    auto const &text(res.expect_ok());
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return 0;
+  }
+
   static void cpp_repl(util::cli::options const &opts)
   {
     using namespace jank;
     using namespace jank::runtime;
 
     {
-      profile::timer const timer{ "require clojure.core" };
+      profile::timer const timer{ profile::region<"require clojure.core"> };
       __rt_ctx->load_module("/clojure.core", module::origin::latest).expect_ok();
     }
 
     if(!opts.target_module.empty())
     {
-      profile::timer const timer{ "load main" };
+      profile::timer const timer{ profile::region<"load main"> };
       __rt_ctx->load_module("/" + opts.target_module, module::origin::latest).expect_ok();
       dynamic_call(__rt_ctx->in_ns_var->deref(), make_box<obj::symbol>(opts.target_module));
     }
@@ -283,21 +299,54 @@ int main(int const argc, char const **argv)
     }
     auto const &opts(parse_result.expect_ok());
 
+    /* Reading a profile doesn't need the runtime, and --profile would overwrite the file. */
+    if(opts.command == util::cli::command::profile_report)
+    {
+      return profile_report(opts);
+    }
+
     if(opts.gc_incremental)
     {
       GC_enable_incremental();
     }
 
     profile::configure(opts);
-    profile::timer const timer{ "main" };
+    profile::timer const timer{ profile::region<"main"> };
 
     __rt_ctx = new(GC) runtime::context{ opts };
 
     jank_load_clojure_core_native();
     jank_load_clojure_string_native();
+    jank_load_clojure_edn_native();
     jank_load_jank_compiler_native();
     jank_load_jank_perf_native();
 
+    if(!opts.profile_sample_file.empty())
+    {
+      auto const res(profile::sample::start(opts.profile_sample_frequency));
+      if(res.is_err())
+      {
+        util::println(stderr, "Unable to start sampling: {}", res.expect_err());
+        return 1;
+      }
+    }
+    util::scope_exit const write_samples{ [&] {
+      if(opts.profile_sample_file.empty() || !profile::sample::is_running())
+      {
+        return;
+      }
+
+      auto const folded(profile::sample::stop());
+      std::ofstream output{ opts.profile_sample_file.data() };
+      if(folded.is_err() || !output.is_open())
+      {
+        util::println(stderr, "Unable to write samples to {}", opts.profile_sample_file);
+        return;
+      }
+      auto const &stacks(folded.expect_ok());
+      output.write(stacks.data(), static_cast<std::streamsize>(stacks.size()));
+    } };
+
     switch(opts.command)
     {
       case util::cli::command::run:
@@ -315,6 +364,9 @@ int main(int const argc, char const **argv)
       case util::cli::command::run_main:
         run_main(opts);
         break;
+      case util::cli::command::profile_report:
+        /* Handled before the runtime is set up. */
+        break;
     }
   }
   JANK_CATCH_THEN(jank::util::print_exception, return 1)
@@ -0,0 +1,113 @@
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/analyze/expr/primitive_literal.hpp>
+#include <jank/analyze/expr/let.hpp>
+#include <jank/jit/processor.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::analyze
+{
+  using namespace jank::runtime;
+
+  static jtl::option<object_ref> folded(expression_ref const expr)
+  {
+    if(auto const literal{ llvm::dyn_cast<expr::primitive_literal>(expr.data) }; literal)
+    {
+      return literal->data;
+    }
+    return none;
+  }
+
+  TEST_SUITE("analyze::fold")
+  {
+    TEST_CASE("Pure calls with constant args")
+    {
+      SUBCASE("Math")
+      {
+        auto const res(__rt_ctx->analyze_string("(+ 1 2)", false));
+        CHECK_EQ(res.size(), 1);
+        CHECK(equal(folded(res[0]).unwrap(), make_box(3)));
+      }
+
+      SUBCASE("Nested")
+      {
+        auto const res(__rt_ctx->analyze_string("(* 2 (inc 1.5))", false));
+        CHECK_EQ(res.size(), 1);
+        CHECK(equal(folded(res[0]).unwrap(), make_box(5.0)));
+      }
+
+      SUBCASE("Strings and keywords")
+      {
+        auto const str_res(__rt_ctx->analyze_string(R"((str "a" "b" 1))", false));
+        CHECK(equal(folded(str_res[0]).unwrap(), make_box("ab1")));
+
+        auto const kw_res(__rt_ctx->analyze_string(R"((keyword "foo"))", false));
+        CHECK(equal(folded(kw_res[0]).unwrap(), __rt_ctx->intern_keyword("foo").expect_ok()));
+      }
+    }
+
+    TEST_CASE("Through let")
+    {
+      auto const res(__rt_ctx->analyze_string("(let* [a 1 b (+ a 2)] b)", false));
+      CHECK_EQ(res.size(), 1);
+
+      auto const let(llvm::cast<expr::let>(res[0].data));
+      CHECK(equal(folded(let->pairs[1].second).unwrap(), make_box(3)));
+    }
+
+    TEST_CASE("Shadowed let")
+    {
+      SUBCASE("Before the rebinding")
+      {
+        auto const res(__rt_ctx->analyze_string("(let* [x 1 y (inc x) x 5] y)", false));
+        CHECK_EQ(res.size(), 1);
+
+        auto const let(llvm::cast<expr::let>(res[0].data));
+        CHECK(equal(folded(let->pairs[1].second).unwrap(), make_box(2)));
+      }
+
+      SUBCASE("After the rebinding")
+      {
+        auto const res(__rt_ctx->analyze_string("(let* [x 1 x (inc x) y (inc x)] y)", false));
+        CHECK_EQ(res.size(), 1);
+
+        auto const let(llvm::cast<expr::let>(res[0].data));
+        CHECK(equal(folded(let->pairs[1].second).unwrap(), make_box(2)));
+        CHECK(folded(let->pairs[2].second).is_none());
+      }
+
+      SUBCASE("Evaluated")
+      {
+        CHECK(equal(__rt_ctx->eval_string("(let* [x 1 x (inc x)] (inc x))"), make_box(3)));
+        CHECK(equal(__rt_ctx->eval_string("(let* [a 1 a 2] (= a 2))"), jank_true));
+      }
+    }
+
+    TEST_CASE("Not folded")
+    {
+      SUBCASE("Non-constant args")
+      {
+        auto const res(__rt_ctx->analyze_string("(+ (rand) 1)", false));
+        CHECK_EQ(res.size(), 1);
+        CHECK(folded(res[0]).is_none());
+      }
+
+      SUBCASE("Throws")
+      {
+        auto const res(__rt_ctx->analyze_string("(/ 1 0)", false));
+        CHECK_EQ(res.size(), 1);
+        CHECK(folded(res[0]).is_none());
+      }
+
+      SUBCASE("Impure")
+      {
+        auto const res(__rt_ctx->analyze_string("(println 1)", false));
+        CHECK_EQ(res.size(), 1);
+        CHECK(folded(res[0]).is_none());
+      }
+    }
+  }
+}
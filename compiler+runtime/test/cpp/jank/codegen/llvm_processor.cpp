@@ -0,0 +1,85 @@
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+
+#include <jank/runtime/context.hpp>
+#include <jank/codegen/llvm_processor.hpp>
+#include <jank/evaluate.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::codegen
+{
+  using namespace jank::runtime;
+
+  struct closure_contexts
+  {
+    usize heap{};
+    usize stack{};
+  };
+
+  /* Counts how the closure contexts in the IR for the code are allocated. The captured
+   * values aren't constants, so they're not folded away. */
+  static closure_contexts count_closure_contexts(native_persistent_string_view const &code)
+  {
+    auto const exprs(__rt_ctx->analyze_string(code, false));
+    REQUIRE(exprs.size() == 1);
+
+    auto const wrapped(evaluate::wrap_expression(exprs[0], "closure_test", {}));
+    llvm_processor cg_prc{ wrapped, "closure_test", compilation_target::eval };
+    cg_prc.gen().expect_ok();
+
+    closure_contexts ret;
+    for(auto const &fn : *cg_prc.ctx->module)
+    {
+      for(auto const &inst : llvm::instructions(fn))
+      {
+        if(auto const call{ llvm::dyn_cast<llvm::CallInst>(&inst) }; call)
+        {
+          auto const callee(call->getCalledFunction());
+          if(callee && callee->getName() == "GC_malloc")
+          {
+            ++ret.heap;
+          }
+        }
+        else if(auto const alloca{ llvm::dyn_cast<llvm::AllocaInst>(&inst) }; alloca)
+        {
+          auto const type{ llvm::dyn_cast<llvm::StructType>(alloca->getAllocatedType()) };
+          if(type && type->hasName() && type->getName().ends_with("_context"))
+          {
+            ++ret.stack;
+          }
+        }
+      }
+    }
+    return ret;
+  }
+
+  TEST_SUITE("codegen::llvm_processor")
+  {
+    TEST_CASE("Closure contexts")
+    {
+      SUBCASE("Local closures are on the stack")
+      {
+        auto const res(count_closure_contexts("(let* [a [1] f (fn* [x] (conj a x))] (f 2))"));
+        CHECK(res.heap == 0);
+        CHECK(res.stack == 1);
+      }
+
+      SUBCASE("Immediately called closures are on the stack")
+      {
+        auto const res(count_closure_contexts("(let* [a [1]] ((fn* [x] (conj a x)) 2))"));
+        CHECK(res.heap == 0);
+        CHECK(res.stack == 1);
+      }
+
+      SUBCASE("Escaping closures are on the heap")
+      {
+        auto const res(count_closure_contexts("(let* [a [1] f (fn* [x] (conj a x))] f)"));
+        CHECK(res.heap == 1);
+        CHECK(res.stack == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,98 @@
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/jit/processor.hpp>
+#include <jank/evaluate.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::evaluate
+{
+  using namespace jank::runtime;
+
+  TEST_SUITE("evaluate")
+  {
+    TEST_CASE("Interpreter")
+    {
+      auto const old_enabled(__rt_ctx->interpreter_enabled);
+      auto const old_threshold(__rt_ctx->interpreter_jit_threshold);
+      __rt_ctx->interpreter_enabled = true;
+      __rt_ctx->interpreter_jit_threshold = 0;
+      util::scope_exit const restore{ [=]() {
+        __rt_ctx->interpreter_enabled = old_enabled;
+        __rt_ctx->interpreter_jit_threshold = old_threshold;
+      } };
+
+      SUBCASE("Fns are interpreted")
+      {
+        auto const res(__rt_ctx->eval_string("(fn* [] 1)"));
+        CHECK_EQ(res->type, object_type::jit_closure);
+        CHECK(equal(dynamic_call(res), make_box(1)));
+      }
+
+      SUBCASE("Let")
+      {
+        auto const res(__rt_ctx->eval_string("(let* [a 1 b [a 2] a :shadowed] [a b])"));
+        CHECK(equal(res, __rt_ctx->eval_string("[:shadowed [1 2]]")));
+      }
+
+      SUBCASE("Closures")
+      {
+        auto const res(__rt_ctx->eval_string("(let* [a 1 f (fn* [b] [a b])] (f 2))"));
+        CHECK(equal(res, __rt_ctx->eval_string("[1 2]")));
+      }
+
+      SUBCASE("Variadic")
+      {
+        auto const res(__rt_ctx->eval_string("((fn* ([] :none) ([a & more] [a more])) 1 2 3)"));
+        CHECK(equal(res, __rt_ctx->eval_string("[1 '(2 3)]")));
+      }
+
+      SUBCASE("Loop and recur")
+      {
+        auto const res(__rt_ctx->eval_string(
+          "(loop* [i 0 acc []] (if (< i 3) (recur (+ i 1) (conj acc i)) acc))"));
+        CHECK(equal(res, __rt_ctx->eval_string("[0 1 2]")));
+      }
+
+      SUBCASE("Named recursion")
+      {
+        auto const res(
+          __rt_ctx->eval_string("((fn* fact [n] (if (< n 2) 1 (* n (fact (- n 1))))) 5)"));
+        CHECK(equal(res, make_box(120)));
+      }
+
+      SUBCASE("Letfn")
+      {
+        auto const res(__rt_ctx->eval_string(
+          "(letfn* [even? (fn* [n] (if (= 0 n) true (odd? (- n 1))))"
+          "         odd? (fn* [n] (if (= 0 n) false (even? (- n 1))))]"
+          "  [(even? 4) (odd? 4)])"));
+        CHECK(equal(res, __rt_ctx->eval_string("[true false]")));
+      }
+
+      SUBCASE("Try")
+      {
+        auto const res(__rt_ctx->eval_string("(try (throw :oops) (catch e [e :caught]))"));
+        CHECK(equal(res, __rt_ctx->eval_string("[:oops :caught]")));
+      }
+
+      SUBCASE("JIT promotion")
+      {
+        __rt_ctx->interpreter_jit_threshold = 2;
+        __rt_ctx->eval_string("(def interpreted-inc (fn* [n] (+ n 1)))");
+        auto const before(promoted_fn_count());
+        CHECK(equal(__rt_ctx->eval_string("(interpreted-inc 1)"), make_box(2)));
+        CHECK_EQ(promoted_fn_count(), before);
+
+        auto const res(__rt_ctx->eval_string(
+          "[(interpreted-inc 2) (interpreted-inc 3) (interpreted-inc 4)]"));
+        CHECK(equal(res, __rt_ctx->eval_string("[3 4 5]")));
+        CHECK_EQ(promoted_fn_count(), before + 1);
+      }
+    }
+  }
+}
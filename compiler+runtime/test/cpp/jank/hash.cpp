@@ -0,0 +1,174 @@
+#include <jank/hash.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_sorted_map.hpp>
+#include <jank/runtime/obj/persistent_hash_set.hpp>
+#include <jank/runtime/obj/persistent_sorted_set.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::hash
+{
+  using namespace jank::runtime;
+
+  /* The one pair at a time version, which the blocked version needs to match. */
+  static u32 reference_string(native_persistent_string_view const &input)
+  {
+    auto const length(input.size());
+    u32 h1{};
+    for(usize i{ 1 }; i < length; i += 2)
+    {
+      h1 = mix_h1(h1, mix_k1(static_cast<u32>(input[i - 1] | (input[i] << 16))));
+    }
+    if((length & 1) == 1)
+    {
+      h1 ^= mix_k1(static_cast<u32>(static_cast<u8>(input[length - 1])));
+    }
+    return fmix(h1, 2 * length);
+  }
+
+  /* The one byte at a time version, as per Java. */
+  static uhash reference_immutable_string(native_persistent_string_view const &input)
+  {
+    uhash h{};
+    for(auto const c : input)
+    {
+      h = 31 * h + (c & 0xff);
+    }
+    return integer(h);
+  }
+
+  /* The hash of the same data, in a collection which hasn't been hashed before. */
+  template <typename T>
+  static uhash fresh_hash(oref<T> const o)
+  {
+    return make_box<T>(o->data)->to_hash();
+  }
+
+  TEST_SUITE("hash")
+  {
+    TEST_CASE("Strings hash the same at any length")
+    {
+      std::string s;
+      for(usize i{}; i < 100; ++i)
+      {
+        CAPTURE(i);
+        CHECK(string(s) == reference_string(s));
+        CHECK(jtl::immutable_string{ s }.to_hash() == reference_immutable_string(s));
+        /* Include some bytes which are negative as chars. */
+        s.push_back(static_cast<char>(i % 3 == 0 ? 0xC3 + i : 'a' + (i % 26)));
+      }
+    }
+
+    TEST_CASE("Symbols and keywords are hashed when they're made")
+    {
+      obj::symbol sym{ "foo", "bar" };
+      CHECK(sym.hash == combine(string("bar"), string("foo")));
+      CHECK(sym.to_hash() == sym.hash);
+
+      sym.set_name("spam");
+      CHECK(sym.hash == combine(string("spam"), string("foo")));
+
+      CHECK(obj::symbol{}.to_hash() == combine(string(""), string("")));
+      CHECK(obj::symbol{ "foo/spam" }.to_hash() == sym.hash);
+
+      auto const kw(__rt_ctx->intern_keyword("foo", "bar").expect_ok());
+      CHECK(kw->hash == static_cast<uhash>(kw->sym->to_hash() + obj::keyword::hash_magic));
+      CHECK(visit(kw.erase()) == kw->hash);
+    }
+
+    TEST_CASE("Derived vectors hash the same as fresh ones")
+    {
+      auto v(obj::persistent_vector::empty());
+      for(i64 i{}; i < 100; ++i)
+      {
+        CHECK(v->to_hash() == fresh_hash(v));
+        v = v->conj(make_box(i));
+      }
+      for(i64 i{}; i < 50; ++i)
+      {
+        CHECK(v->to_hash() == fresh_hash(v));
+        v = v->pop();
+      }
+      CHECK(v->to_hash() == fresh_hash(v));
+      CHECK(v->with_meta(obj::persistent_array_map::empty())->to_hash() == v->to_hash());
+    }
+
+    TEST_CASE("Derived maps hash the same as fresh ones")
+    {
+      auto const kw(__rt_ctx->intern_keyword("k").expect_ok());
+
+      object_ref a(obj::persistent_array_map::empty());
+      auto h(obj::persistent_hash_map::empty());
+      auto s(obj::persistent_sorted_map::empty());
+      for(i64 i{}; i < 50; ++i)
+      {
+        /* Replacing a value as well as adding keys. */
+        for(auto const val : { make_box(i).erase(), kw.erase() })
+        {
+          a = assoc(a, make_box(i % 20), val);
+          h = h->assoc(make_box(i % 20), val);
+          s = s->assoc(make_box(i % 20), val);
+          CHECK(visit(a) == h->to_hash());
+          CHECK(h->to_hash() == fresh_hash(h));
+          CHECK(s->to_hash() == fresh_hash(s));
+        }
+        if(i % 3 == 0)
+        {
+          a = dissoc(a, make_box(i / 3));
+          h = h->dissoc(make_box(i / 3));
+          s = s->dissoc(make_box(i / 3));
+          CHECK(visit(a) == h->to_hash());
+          CHECK(h->to_hash() == fresh_hash(h));
+          CHECK(s->to_hash() == fresh_hash(s));
+        }
+      }
+    }
+
+    TEST_CASE("Derived sets hash the same as fresh ones")
+    {
+      auto h(obj::persistent_hash_set::empty());
+      auto s(obj::persistent_sorted_set::empty());
+      for(i64 i{}; i < 50; ++i)
+      {
+        h = h->conj(make_box(i % 20));
+        s = s->conj(make_box(i % 20));
+        CHECK(h->to_hash() == fresh_hash(h));
+        CHECK(s->to_hash() == fresh_hash(s));
+        CHECK(h->to_hash() == s->to_hash());
+        if(i % 3 == 0)
+        {
+          h = h->disj(make_box(i / 3));
+          s = s->disj(make_box(i / 3));
+          CHECK(h->to_hash() == fresh_hash(h));
+          CHECK(s->to_hash() == fresh_hash(s));
+        }
+      }
+    }
+
+    TEST_CASE("Items which haven't been hashed aren't hashed on conj")
+    {
+      auto const inner(make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box(2)));
+      auto v(obj::persistent_vector::empty()->conj(make_box(0)));
+      CHECK(v->to_hash() == fresh_hash(v));
+
+      v = v->conj(inner);
+      CHECK(inner->items_hash == 0);
+      CHECK(v->items_hash == 0);
+      CHECK(v->to_hash() == fresh_hash(v));
+
+      /* Once it has been, conj keeps our hash up to date again. */
+      v = v->conj(inner);
+      CHECK(v->items_hash != 0);
+      CHECK(v->to_hash() == fresh_hash(v));
+    }
+  }
+}
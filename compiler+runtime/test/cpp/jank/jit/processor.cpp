@@ -1,4 +1,6 @@
+#include <chrono>
 #include <filesystem>
+#include <thread>
 
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Frontend/TextDiagnosticPrinter.h>
@@ -165,5 +167,33 @@ namespace jank::jit
       }
       util::print("tested {} jank files\n", test_count);
     }
+
+    TEST_CASE("tier up")
+    {
+      auto const &jit_prc(__rt_ctx->jit_prc);
+      if(jit_prc.tier_up_threshold == 0)
+      {
+        return;
+      }
+
+      auto const before(jit_prc.tiered_up_count());
+      auto const code(util::format("(def tier-up-test (fn* [a] (+ a 1)))"
+                                   "(loop* [i 0]"
+                                   "  (if (< i {})"
+                                   "    (do (tier-up-test i) (recur (inc i)))"
+                                   "    nil))",
+                                   jit_prc.tier_up_threshold + 1));
+      __rt_ctx->eval_string({ code.data(), code.size() });
+
+      /* The fn is recompiled in the background, so we need to give it some time. */
+      auto const deadline(std::chrono::steady_clock::now() + std::chrono::seconds{ 30 });
+      while(jit_prc.tiered_up_count() == before && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+      }
+      CHECK(before < jit_prc.tiered_up_count());
+      CHECK(runtime::equal(__rt_ctx->eval_string("(tier-up-test 41)"),
+                           __rt_ctx->eval_string("42")));
+    }
   }
 }
@@ -0,0 +1,73 @@
+#include <chrono>
+
+#include <cpptrace/basic.hpp>
+
+#include <jank/profile/sample.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::profile::sample
+{
+  /* Burns CPU time, since that's what the sampling timer counts. This isn't inlined, so
+   * that it shows up in the sampled stacks. */
+  [[gnu::noinline]]
+  static u64 spin(std::chrono::milliseconds const duration)
+  {
+    u64 volatile sum{};
+    auto const end(std::chrono::steady_clock::now() + duration);
+    while(std::chrono::steady_clock::now() < end)
+    {
+      for(u64 i{}; i < 1000; ++i)
+      {
+        sum = sum + i;
+      }
+    }
+    return sum;
+  }
+
+  TEST_SUITE("sample")
+  {
+    TEST_CASE("Signal safe unwinding")
+    {
+      /* We build cpptrace with libunwind, so anything else is a broken build. */
+      CHECK(cpptrace::can_signal_safe_unwind());
+    }
+
+    TEST_CASE("Invalid frequencies")
+    {
+      CHECK(start(0).is_err());
+      CHECK(start(1'000'001).is_err());
+      CHECK(!is_running());
+    }
+
+    TEST_CASE("Every valid frequency starts the timer")
+    {
+      REQUIRE(cpptrace::can_signal_safe_unwind());
+      for(auto const frequency : { 1u, 2u, 999u, 1'000'000u })
+      {
+        CAPTURE(frequency);
+        REQUIRE(start(frequency).is_ok());
+        CHECK(is_running());
+        CHECK(start(frequency).is_err());
+        CHECK(stop().is_ok());
+        CHECK(!is_running());
+      }
+      CHECK(stop().is_err());
+    }
+
+    TEST_CASE("Samples are collected")
+    {
+      REQUIRE(cpptrace::can_signal_safe_unwind());
+      REQUIRE(start(1000).is_ok());
+      spin(std::chrono::milliseconds{ 200 });
+      auto const folded(stop());
+      REQUIRE(folded.is_ok());
+
+      /* Each line is a stack, so the spinning needs to be in one of them, not just in
+       * some empty samples. */
+      auto const &stacks(folded.expect_ok());
+      CHECK(stacks.find("spin(") != jtl::immutable_string::npos);
+    }
+  }
+}
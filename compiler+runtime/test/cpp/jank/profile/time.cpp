@@ -0,0 +1,72 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <jank/profile/time.hpp>
+#include <jank/util/scope_exit.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::profile
+{
+  TEST_SUITE("profile::time")
+  {
+    TEST_CASE("Round trip")
+    {
+      auto const path(std::filesystem::temp_directory_path() / "jank-profile-round-trip");
+      util::scope_exit const cleanup{ [&] {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+      } };
+
+      util::cli::options opts;
+      opts.profiler_enabled = true;
+      opts.profiler_file = path.string();
+      configure(opts);
+      REQUIRE(is_enabled());
+
+      /* This thread's records are flushed when it exits. */
+      std::thread{ [] {
+        timer const outer{ region<"round trip outer"> };
+        timer const inner{ [] { return std::string{ "round trip inner" }; } };
+        report("round trip boundary");
+      } }.join();
+      finish();
+      CHECK(!is_enabled());
+
+      auto const decoded(decode(path.c_str()));
+      REQUIRE(decoded.is_ok());
+      auto const &text(decoded.expect_ok());
+
+      /* The records are in time order. */
+      usize pos{};
+      for(auto const expected : { " enter round trip outer\n",
+                                  " enter round trip inner\n",
+                                  " report round trip boundary\n",
+                                  " exit round trip inner\n",
+                                  " exit round trip outer\n" })
+      {
+        CAPTURE(expected);
+        auto const found(text.find(expected, pos));
+        REQUIRE(found != jtl::immutable_string::npos);
+        pos = found;
+      }
+      CHECK(text.starts_with("jank::profile "));
+    }
+
+    TEST_CASE("Only profiles are decoded")
+    {
+      auto const path(std::filesystem::temp_directory_path() / "jank-profile-not-a-profile");
+      util::scope_exit const cleanup{ [&] {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+      } };
+      std::ofstream{ path } << "not a profile";
+
+      CHECK(decode(path.c_str()).is_err());
+      CHECK(decode("/definitely/not/a/profile").is_err());
+    }
+  }
+}
@@ -0,0 +1,150 @@
+#include <jank/read/data.hpp>
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/rtti.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::read::data
+{
+  using namespace jank::runtime;
+
+  static object_ref parse_first(native_persistent_string_view const &s)
+  {
+    lex::processor lp{ s };
+    parse::processor pp{ lp.begin(), lp.end() };
+    return pp.next().expect_ok().unwrap().ptr;
+  }
+
+  TEST_SUITE("data")
+  {
+    TEST_CASE("Same forms as the parser")
+    {
+      /* Source metadata refers to *current-file*, which needs to be the same for both. */
+      context::binding_scope const preserve{ *__rt_ctx,
+                                             obj::persistent_hash_map::create_unique(
+                                               std::make_pair(__rt_ctx->current_file_var,
+                                                              jank_nil.erase())) };
+
+      for(auto const s : { "nil",
+                           "true",
+                           "-42",
+                           "0",
+                           "017",
+                           "2r101",
+                           "123456789012345678",
+                           "1234567890123456789",
+                           "1.5e-3",
+                           "-2.",
+                           "3/4",
+                           "4/2",
+                           "\"plain\"",
+                           "\"esc\\\"aped\\n\"",
+                           "\"ünïcode\"",
+                           "\\a",
+                           "\\space",
+                           "\\u00e9",
+                           ":kw",
+                           ":ns/kw",
+                           "sym",
+                           "ns/sym",
+                           "/",
+                           "+1",
+                           "ünïcode",
+                           "##-Inf",
+                           "(1 (2) [3])",
+                           "[a\n  b ; comment\n c]",
+                           "{:a 1, :b [2 3]}",
+                           "{1 1 2 2 3 3 4 4 5 5 6 6 7 7 8 8 9 9 10 10}",
+                           "#{1 2 3}",
+                           "[1 #_ 2 3]",
+                           "^:tag [x]",
+                           "^{:a 1} ^:b (y)" })
+      {
+        CAPTURE(s);
+        auto const parsed(parse_first(s));
+
+        reader r{ s, true };
+        auto const res(r.next());
+        REQUIRE(res.is_ok());
+        auto const form(res.expect_ok().unwrap());
+        CHECK(equal(form, parsed));
+        CHECK(equal(meta(form), meta(parsed)));
+        /* Equal maps can still iterate, and print, in a different order, if one is an array
+         * map and the other is a hash map. */
+        CHECK(form->type == parsed->type);
+        CHECK(to_code_string(form) == to_code_string(parsed));
+        CHECK(r.next().expect_ok().is_none());
+
+        reader bare{ s, false };
+        auto const bare_form(bare.next().expect_ok().unwrap());
+        CHECK(equal(bare_form, parsed));
+        CHECK(equal(strip_source_from_meta(meta(bare_form)), meta(bare_form)));
+      }
+    }
+
+    TEST_CASE("Large maps are hash maps")
+    {
+      auto const s{ "{1 1 2 2 3 3 4 4 5 5 6 6 7 7 8 8 9 9}" };
+      reader r{ s, false };
+      auto const form(r.next().expect_ok().unwrap());
+      CHECK(form->type == object_type::persistent_hash_map);
+      CHECK(sequence_length(form) == 9);
+
+      /* The parser promotes at the same size, so code and data agree on iteration order. */
+      CHECK(parse_first(s)->type == object_type::persistent_hash_map);
+      CHECK(parse_first("{1 1 2 2 3 3 4 4 5 5 6 6 7 7 8 8}")->type
+            == object_type::persistent_array_map);
+    }
+
+    TEST_CASE("Multiple forms")
+    {
+      reader r{ "1 ; one\n #_ skipped :two #! three\n", false };
+      CHECK(equal(r.next().expect_ok().unwrap(), make_box(1)));
+      CHECK(equal(r.next().expect_ok().unwrap(), __rt_ctx->intern_keyword("two").expect_ok()));
+      CHECK(r.next().expect_ok().is_none());
+
+      CHECK(equal(read_last("1 2 3", false).expect_ok(), make_box(3)));
+      CHECK(equal(read_last("", false).expect_ok(), jank_nil));
+    }
+
+    TEST_CASE("Unsupported")
+    {
+      for(auto const s : { "'a",
+                           "`a",
+                           "~a",
+                           "@a",
+                           "#(inc %)",
+                           "#'a",
+                           "#?(:jank 1)",
+                           "[1",
+                           "]",
+                           "(1]",
+                           "{:a}",
+                           "\"open",
+                           "\"bad \\q escape\"",
+                           "\\",
+                           "1/0",
+                           "1.5e",
+                           "[a\"b\"]",
+                           ":",
+                           ":::a",
+                           "/a",
+                           "^1 [x]",
+                           "^:a 1",
+                           "#_" })
+      {
+        CAPTURE(s);
+        reader r{ s, false };
+        CHECK(r.next().is_err());
+      }
+    }
+  }
+}
@@ -1,5 +1,6 @@
 #include <array>
 #include <ostream>
+#include <string>
 
 #include <jank/read/lex.hpp>
 
@@ -1266,6 +1267,20 @@ namespace jank::read::lex
         }));
       }
 
+      SUBCASE("With non-special punctuation")
+      {
+        processor p{ "foo@bar x' a$b a|b a:b" };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                {  0, 7, token_kind::symbol, "foo@bar"sv },
+                {  8, 2, token_kind::symbol,      "x'"sv },
+                { 11, 3, token_kind::symbol,     "a$b"sv },
+                { 15, 3, token_kind::symbol,     "a|b"sv },
+                { 19, 3, token_kind::symbol,     "a:b"sv }
+        }));
+      }
+
       SUBCASE("Only -")
       {
         processor p{ "-" };
@@ -1415,6 +1430,20 @@ namespace jank::read::lex
         }));
       }
 
+      SUBCASE("With non-special punctuation")
+      {
+        processor p{ ":a:b :foo@bar :x' :a$b :a|b" };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                {  0, 4, token_kind::keyword,     "a:b"sv },
+                {  5, 8, token_kind::keyword, "foo@bar"sv },
+                { 14, 3, token_kind::keyword,      "x'"sv },
+                { 18, 4, token_kind::keyword,     "a$b"sv },
+                { 23, 4, token_kind::keyword,     "a|b"sv }
+        }));
+      }
+
       SUBCASE("Auto-resolved unqualified")
       {
         processor p{ "::foo-bar" };
@@ -2117,5 +2146,127 @@ namespace jank::read::lex
               }));
       }
     }
+
+    /* ASCII runs are skipped in blocks, so these are long enough to span several blocks and
+     * to end part way through one. */
+    TEST_CASE("Long ASCII runs")
+    {
+      SUBCASE("Symbol")
+      {
+        std::string const name(70, 'a');
+        std::string const source{ "(" + name + ")" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                {  0,  1,   token_kind::open_paren },
+                {  1, 70, token_kind::symbol, name },
+                { 71,  1, token_kind::close_paren }
+        }));
+      }
+
+      SUBCASE("Symbol with UTF-8 inside")
+      {
+        std::string const name{ std::string(40, 'x') + "🍺" + std::string(20, 'y') };
+        processor p{ name };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { 0, 64, token_kind::symbol, name }
+        }));
+      }
+
+      /* These aren't special to the reader, so they're part of the symbol, just as they are
+       * when the lexer goes one codepoint at a time. */
+      SUBCASE("Symbol with non-special punctuation")
+      {
+        for(auto const c : { '\'', '@', ':', '$', '|' })
+        {
+          std::string const name{ std::string(40, 'a') + c + "b" };
+          processor p{ name };
+          native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { 0, 42, token_kind::symbol, name }
+          }));
+        }
+      }
+
+      SUBCASE("Keyword with non-special punctuation")
+      {
+        for(auto const c : { '\'', '@', ':', '$', '|' })
+        {
+          std::string const name{ std::string(40, 'k') + c + "b" };
+          std::string const source{ ":" + name };
+          processor p{ source };
+          native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { 0, 43, token_kind::keyword, name }
+          }));
+        }
+      }
+
+      SUBCASE("Keyword")
+      {
+        std::string const name(50, 'k');
+        std::string const source{ ":" + name + " 1" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                {  0, 51, token_kind::keyword, name },
+                { 52,  1, token_kind::integer,  1ll }
+        }));
+      }
+
+      SUBCASE("String with line breaks")
+      {
+        std::string const contents{ std::string(40, 'a') + "\n" + std::string(20, 'b') };
+        std::string const source{ "\"" + contents + "\"" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { { 0, 1, 1 }, { 63, 2, 22 }, token_kind::string, contents }
+        }));
+      }
+
+      SUBCASE("String with escape")
+      {
+        std::string const contents{ std::string(40, 'a') + "\\\"" + std::string(20, 'b') };
+        std::string const source{ "\"" + contents + "\"" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { 0, 64, token_kind::escaped_string, contents }
+        }));
+      }
+
+      SUBCASE("Comment")
+      {
+        std::string const contents{ " " + std::string(50, 'c') };
+        std::string const source{ ";" + contents + "\n1" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                {  { 0, 1, 1 }, { 52, 1, 53 }, token_kind::comment, contents },
+                { { 53, 2, 1 }, { 54, 2, 2 },  token_kind::integer,      1ll }
+        }));
+      }
+
+      SUBCASE("Whitespace")
+      {
+        std::string const source{ std::string(40, ' ') + "\n" + std::string(40, ',') + "1" };
+        processor p{ source };
+        native_vector<jtl::result<token, error_ref>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { { 81, 2, 41 }, { 82, 2, 42 }, token_kind::integer, 1ll }
+        }));
+      }
+    }
   }
 }
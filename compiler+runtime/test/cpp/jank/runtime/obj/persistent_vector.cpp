@@ -1,4 +1,6 @@
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_vector_sequence.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/equal.hpp>
 
@@ -81,5 +83,39 @@ namespace jank::runtime::obj
       CHECK(!equal(make_box<persistent_vector>(std::in_place, make_box('f'), make_box('o')).erase(),
                    make_box<persistent_vector>(std::in_place, make_box('f')).erase()));
     }
+    TEST_CASE("chunked seq")
+    {
+      persistent_vector::value_type data;
+      for(i64 i{}; i < 100; ++i)
+      {
+        data = data.push_back(make_box(i));
+      }
+      auto const big(make_box<persistent_vector>(std::move(data)));
+
+      /* Walking by chunk visits every element once, in order, and each chunk only covers
+       * the rest of its leaf. */
+      i64 expected{};
+      usize chunks{};
+      for(auto s(big->seq()); s.is_some(); s = s->chunked_next())
+      {
+        auto const chunk(s->chunked_first());
+        CHECK(0 < chunk->count());
+        CHECK(chunk->count() <= s->count());
+        for(usize i{}; i < chunk->count(); ++i, ++expected)
+        {
+          CHECK(equal(chunk->nth(make_box(static_cast<i64>(i))), make_box(expected)));
+        }
+        ++chunks;
+      }
+      CHECK(expected == 100);
+      CHECK(1 < chunks);
+
+      /* Starting part way through a leaf only covers the rest of that leaf. */
+      auto const mid_seq(make_box<persistent_vector_sequence>(big, 3));
+      auto const mid_chunk(mid_seq->chunked_first());
+      CHECK(equal(mid_chunk->nth(make_box(0)), make_box(3)));
+      CHECK(equal(mid_chunk->chunk_next()->nth(make_box(0)), make_box(4)));
+      CHECK(mid_chunk->chunk_next()->count() == mid_chunk->count() - 1);
+    }
   }
 }
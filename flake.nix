@@ -25,6 +25,7 @@
 
             ## Required libs.
             boehmgc
+            libunwind
             libzip
             openssl
 